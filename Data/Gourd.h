@@ -0,0 +1,286 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Gourd.h - data for a gourd made of degree 4x2 Bezier patches
+//
+//////////////////////////////////////////////////////////////////////////////
+
+const int NumGourdRows = 9;      // Along the profile, bottom to top
+const int NumGourdColumns = 16;  // Around the axis
+const int NumGourdVertices = NumGourdRows * NumGourdColumns;
+const int NumGourdPatches = 16;
+const int NumGourdVerticesPerPatch = 15;  // Quartic along the profile, quadratic around
+const int NumGourdIndices = NumGourdVerticesPerPatch * NumGourdPatches;
+
+//
+//  GourdVertices - Control mesh of the gourd, row by row. Each row is a
+//    circle of 8 quadratic arcs, whose middle control points are pushed out
+//    to where the end tangents meet; the profile is two quartic arcs that
+//    meet tangentially at the neck. Both ends close to a point.
+//
+
+static const float GourdVertices[NumGourdVertices][3] = {
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 0.0, 0.0, 0.0 },
+    { 1.0, 0.0, 0.0 },
+    { 1.0, 0.0, -0.4142 },
+    { 0.7071, 0.0, -0.7071 },
+    { 0.4142, 0.0, -1.0 },
+    { 0.0, 0.0, -1.0 },
+    { -0.4142, 0.0, -1.0 },
+    { -0.7071, 0.0, -0.7071 },
+    { -1.0, 0.0, -0.4142 },
+    { -1.0, 0.0, 0.0 },
+    { -1.0, 0.0, 0.4142 },
+    { -0.7071, 0.0, 0.7071 },
+    { -0.4142, 0.0, 1.0 },
+    { 0.0, 0.0, 1.0 },
+    { 0.4142, 0.0, 1.0 },
+    { 0.7071, 0.0, 0.7071 },
+    { 1.0, 0.0, 0.4142 },
+    { 1.6, 0.6, 0.0 },
+    { 1.6, 0.6, -0.6627 },
+    { 1.1314, 0.6, -1.1314 },
+    { 0.6627, 0.6, -1.6 },
+    { 0.0, 0.6, -1.6 },
+    { -0.6627, 0.6, -1.6 },
+    { -1.1314, 0.6, -1.1314 },
+    { -1.6, 0.6, -0.6627 },
+    { -1.6, 0.6, 0.0 },
+    { -1.6, 0.6, 0.6627 },
+    { -1.1314, 0.6, 1.1314 },
+    { -0.6627, 0.6, 1.6 },
+    { 0.0, 0.6, 1.6 },
+    { 0.6627, 0.6, 1.6 },
+    { 1.1314, 0.6, 1.1314 },
+    { 1.6, 0.6, 0.6627 },
+    { 1.4, 1.4, 0.0 },
+    { 1.4, 1.4, -0.5799 },
+    { 0.9899, 1.4, -0.9899 },
+    { 0.5799, 1.4, -1.4 },
+    { 0.0, 1.4, -1.4 },
+    { -0.5799, 1.4, -1.4 },
+    { -0.9899, 1.4, -0.9899 },
+    { -1.4, 1.4, -0.5799 },
+    { -1.4, 1.4, 0.0 },
+    { -1.4, 1.4, 0.5799 },
+    { -0.9899, 1.4, 0.9899 },
+    { -0.5799, 1.4, 1.4 },
+    { 0.0, 1.4, 1.4 },
+    { 0.5799, 1.4, 1.4 },
+    { 0.9899, 1.4, 0.9899 },
+    { 1.4, 1.4, 0.5799 },
+    { 0.9, 1.8, 0.0 },
+    { 0.9, 1.8, -0.3728 },
+    { 0.6364, 1.8, -0.6364 },
+    { 0.3728, 1.8, -0.9 },
+    { 0.0, 1.8, -0.9 },
+    { -0.3728, 1.8, -0.9 },
+    { -0.6364, 1.8, -0.6364 },
+    { -0.9, 1.8, -0.3728 },
+    { -0.9, 1.8, 0.0 },
+    { -0.9, 1.8, 0.3728 },
+    { -0.6364, 1.8, 0.6364 },
+    { -0.3728, 1.8, 0.9 },
+    { 0.0, 1.8, 0.9 },
+    { 0.3728, 1.8, 0.9 },
+    { 0.6364, 1.8, 0.6364 },
+    { 0.9, 1.8, 0.3728 },
+    { 0.4, 2.2, 0.0 },
+    { 0.4, 2.2, -0.1657 },
+    { 0.2828, 2.2, -0.2828 },
+    { 0.1657, 2.2, -0.4 },
+    { 0.0, 2.2, -0.4 },
+    { -0.1657, 2.2, -0.4 },
+    { -0.2828, 2.2, -0.2828 },
+    { -0.4, 2.2, -0.1657 },
+    { -0.4, 2.2, 0.0 },
+    { -0.4, 2.2, 0.1657 },
+    { -0.2828, 2.2, 0.2828 },
+    { -0.1657, 2.2, 0.4 },
+    { 0.0, 2.2, 0.4 },
+    { 0.1657, 2.2, 0.4 },
+    { 0.2828, 2.2, 0.2828 },
+    { 0.4, 2.2, 0.1657 },
+    { 0.5, 2.8, 0.0 },
+    { 0.5, 2.8, -0.2071 },
+    { 0.3536, 2.8, -0.3536 },
+    { 0.2071, 2.8, -0.5 },
+    { 0.0, 2.8, -0.5 },
+    { -0.2071, 2.8, -0.5 },
+    { -0.3536, 2.8, -0.3536 },
+    { -0.5, 2.8, -0.2071 },
+    { -0.5, 2.8, 0.0 },
+    { -0.5, 2.8, 0.2071 },
+    { -0.3536, 2.8, 0.3536 },
+    { -0.2071, 2.8, 0.5 },
+    { 0.0, 2.8, 0.5 },
+    { 0.2071, 2.8, 0.5 },
+    { 0.3536, 2.8, 0.3536 },
+    { 0.5, 2.8, 0.2071 },
+    { 0.7, 3.0, 0.0 },
+    { 0.7, 3.0, -0.2899 },
+    { 0.495, 3.0, -0.495 },
+    { 0.2899, 3.0, -0.7 },
+    { 0.0, 3.0, -0.7 },
+    { -0.2899, 3.0, -0.7 },
+    { -0.495, 3.0, -0.495 },
+    { -0.7, 3.0, -0.2899 },
+    { -0.7, 3.0, 0.0 },
+    { -0.7, 3.0, 0.2899 },
+    { -0.495, 3.0, 0.495 },
+    { -0.2899, 3.0, 0.7 },
+    { 0.0, 3.0, 0.7 },
+    { 0.2899, 3.0, 0.7 },
+    { 0.495, 3.0, 0.495 },
+    { 0.7, 3.0, 0.2899 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 },
+    { 0.0, 3.0, 0.0 }
+ };
+
+//
+//  GourdIndices - Indices into the control mesh for each patch, 5 rows of 3
+//    control points. Neighboring patches share a row or a column of them.
+//
+
+static const unsigned GourdIndices[NumGourdPatches][5][3] = {
+    {
+	{0, 1, 2},
+	{16, 17, 18},
+	{32, 33, 34},
+	{48, 49, 50},
+	{64, 65, 66}
+    },
+    {
+	{2, 3, 4},
+	{18, 19, 20},
+	{34, 35, 36},
+	{50, 51, 52},
+	{66, 67, 68}
+    },
+    {
+	{4, 5, 6},
+	{20, 21, 22},
+	{36, 37, 38},
+	{52, 53, 54},
+	{68, 69, 70}
+    },
+    {
+	{6, 7, 8},
+	{22, 23, 24},
+	{38, 39, 40},
+	{54, 55, 56},
+	{70, 71, 72}
+    },
+    {
+	{8, 9, 10},
+	{24, 25, 26},
+	{40, 41, 42},
+	{56, 57, 58},
+	{72, 73, 74}
+    },
+    {
+	{10, 11, 12},
+	{26, 27, 28},
+	{42, 43, 44},
+	{58, 59, 60},
+	{74, 75, 76}
+    },
+    {
+	{12, 13, 14},
+	{28, 29, 30},
+	{44, 45, 46},
+	{60, 61, 62},
+	{76, 77, 78}
+    },
+    {
+	{14, 15, 0},
+	{30, 31, 16},
+	{46, 47, 32},
+	{62, 63, 48},
+	{78, 79, 64}
+    },
+    {
+	{64, 65, 66},
+	{80, 81, 82},
+	{96, 97, 98},
+	{112, 113, 114},
+	{128, 129, 130}
+    },
+    {
+	{66, 67, 68},
+	{82, 83, 84},
+	{98, 99, 100},
+	{114, 115, 116},
+	{130, 131, 132}
+    },
+    {
+	{68, 69, 70},
+	{84, 85, 86},
+	{100, 101, 102},
+	{116, 117, 118},
+	{132, 133, 134}
+    },
+    {
+	{70, 71, 72},
+	{86, 87, 88},
+	{102, 103, 104},
+	{118, 119, 120},
+	{134, 135, 136}
+    },
+    {
+	{72, 73, 74},
+	{88, 89, 90},
+	{104, 105, 106},
+	{120, 121, 122},
+	{136, 137, 138}
+    },
+    {
+	{74, 75, 76},
+	{90, 91, 92},
+	{106, 107, 108},
+	{122, 123, 124},
+	{138, 139, 140}
+    },
+    {
+	{76, 77, 78},
+	{92, 93, 94},
+	{108, 109, 110},
+	{124, 125, 126},
+	{140, 141, 142}
+    },
+    {
+	{78, 79, 64},
+	{94, 95, 80},
+	{110, 111, 96},
+	{126, 127, 112},
+	{142, 143, 128}
+    }
+};
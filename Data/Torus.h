@@ -0,0 +1,700 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Torus.h - data for a uniform bicubic B-spline torus
+//
+//////////////////////////////////////////////////////////////////////////////
+
+const int NumTorusRings = 12;  // Around the axis
+const int NumTorusSides = 8;   // Around the tube
+const int NumTorusVertices = NumTorusRings * NumTorusSides;
+const int NumTorusPatches = NumTorusVertices;  // Closed both ways, so one span per control point
+const int NumTorusVerticesPerPatch = 16;  // 4x4 B-spline control points per span
+const int NumTorusIndices = NumTorusVerticesPerPatch * NumTorusPatches;
+
+//
+//  TorusVertices - Control mesh of the torus, ring by ring. The tube's radius
+//    swells and narrows three times around the axis.
+//
+
+static const float TorusVertices[NumTorusVertices][3] = {
+    { 2.8, 0.0, 0.0 },
+    { 2.5657, 0.5657, 0.0 },
+    { 2.0, 0.8, 0.0 },
+    { 1.4343, 0.5657, 0.0 },
+    { 1.2, 0.0, 0.0 },
+    { 1.4343, -0.5657, 0.0 },
+    { 2.0, -0.8, 0.0 },
+    { 2.5657, -0.5657, 0.0 },
+    { 2.2517, 0.0, 1.3 },
+    { 2.0995, 0.4243, 1.2121 },
+    { 1.7321, 0.6, 1.0 },
+    { 1.3646, 0.4243, 0.7879 },
+    { 1.2124, 0.0, 0.7 },
+    { 1.3646, -0.4243, 0.7879 },
+    { 1.7321, -0.6, 1.0 },
+    { 2.0995, -0.4243, 1.2121 },
+    { 1.2, 0.0, 2.0785 },
+    { 1.1414, 0.2828, 1.977 },
+    { 1.0, 0.4, 1.7321 },
+    { 0.8586, 0.2828, 1.4871 },
+    { 0.8, 0.0, 1.3856 },
+    { 0.8586, -0.2828, 1.4871 },
+    { 1.0, -0.4, 1.7321 },
+    { 1.1414, -0.2828, 1.977 },
+    { 0.0, 0.0, 2.6 },
+    { 0.0, 0.4243, 2.4243 },
+    { 0.0, 0.6, 2.0 },
+    { 0.0, 0.4243, 1.5757 },
+    { 0.0, 0.0, 1.4 },
+    { 0.0, -0.4243, 1.5757 },
+    { 0.0, -0.6, 2.0 },
+    { 0.0, -0.4243, 2.4243 },
+    { -1.4, 0.0, 2.4249 },
+    { -1.2828, 0.5657, 2.2219 },
+    { -1.0, 0.8, 1.7321 },
+    { -0.7172, 0.5657, 1.2422 },
+    { -0.6, 0.0, 1.0392 },
+    { -0.7172, -0.5657, 1.2422 },
+    { -1.0, -0.8, 1.7321 },
+    { -1.2828, -0.5657, 2.2219 },
+    { -2.2517, 0.0, 1.3 },
+    { -2.0995, 0.4243, 1.2121 },
+    { -1.7321, 0.6, 1.0 },
+    { -1.3646, 0.4243, 0.7879 },
+    { -1.2124, 0.0, 0.7 },
+    { -1.3646, -0.4243, 0.7879 },
+    { -1.7321, -0.6, 1.0 },
+    { -2.0995, -0.4243, 1.2121 },
+    { -2.4, 0.0, 0.0 },
+    { -2.2828, 0.2828, 0.0 },
+    { -2.0, 0.4, 0.0 },
+    { -1.7172, 0.2828, 0.0 },
+    { -1.6, 0.0, 0.0 },
+    { -1.7172, -0.2828, 0.0 },
+    { -2.0, -0.4, 0.0 },
+    { -2.2828, -0.2828, 0.0 },
+    { -2.2517, 0.0, -1.3 },
+    { -2.0995, 0.4243, -1.2121 },
+    { -1.7321, 0.6, -1.0 },
+    { -1.3646, 0.4243, -0.7879 },
+    { -1.2124, 0.0, -0.7 },
+    { -1.3646, -0.4243, -0.7879 },
+    { -1.7321, -0.6, -1.0 },
+    { -2.0995, -0.4243, -1.2121 },
+    { -1.4, 0.0, -2.4249 },
+    { -1.2828, 0.5657, -2.2219 },
+    { -1.0, 0.8, -1.7321 },
+    { -0.7172, 0.5657, -1.2422 },
+    { -0.6, 0.0, -1.0392 },
+    { -0.7172, -0.5657, -1.2422 },
+    { -1.0, -0.8, -1.7321 },
+    { -1.2828, -0.5657, -2.2219 },
+    { 0.0, 0.0, -2.6 },
+    { 0.0, 0.4243, -2.4243 },
+    { 0.0, 0.6, -2.0 },
+    { 0.0, 0.4243, -1.5757 },
+    { 0.0, 0.0, -1.4 },
+    { 0.0, -0.4243, -1.5757 },
+    { 0.0, -0.6, -2.0 },
+    { 0.0, -0.4243, -2.4243 },
+    { 1.2, 0.0, -2.0785 },
+    { 1.1414, 0.2828, -1.977 },
+    { 1.0, 0.4, -1.7321 },
+    { 0.8586, 0.2828, -1.4871 },
+    { 0.8, 0.0, -1.3856 },
+    { 0.8586, -0.2828, -1.4871 },
+    { 1.0, -0.4, -1.7321 },
+    { 1.1414, -0.2828, -1.977 },
+    { 2.2517, 0.0, -1.3 },
+    { 2.0995, 0.4243, -1.2121 },
+    { 1.7321, 0.6, -1.0 },
+    { 1.3646, 0.4243, -0.7879 },
+    { 1.2124, 0.0, -0.7 },
+    { 1.3646, -0.4243, -0.7879 },
+    { 1.7321, -0.6, -1.0 },
+    { 2.0995, -0.4243, -1.2121 }
+ };
+
+//
+//  TorusIndices - Indices into the control mesh for each span, the 4x4
+//    control points around it. Neighboring spans share 12 of them.
+//
+
+static const unsigned TorusIndices[NumTorusPatches][4][4] = {
+    {
+	{0, 1, 2, 3},
+	{8, 9, 10, 11},
+	{16, 17, 18, 19},
+	{24, 25, 26, 27}
+    },
+    {
+	{1, 2, 3, 4},
+	{9, 10, 11, 12},
+	{17, 18, 19, 20},
+	{25, 26, 27, 28}
+    },
+    {
+	{2, 3, 4, 5},
+	{10, 11, 12, 13},
+	{18, 19, 20, 21},
+	{26, 27, 28, 29}
+    },
+    {
+	{3, 4, 5, 6},
+	{11, 12, 13, 14},
+	{19, 20, 21, 22},
+	{27, 28, 29, 30}
+    },
+    {
+	{4, 5, 6, 7},
+	{12, 13, 14, 15},
+	{20, 21, 22, 23},
+	{28, 29, 30, 31}
+    },
+    {
+	{5, 6, 7, 0},
+	{13, 14, 15, 8},
+	{21, 22, 23, 16},
+	{29, 30, 31, 24}
+    },
+    {
+	{6, 7, 0, 1},
+	{14, 15, 8, 9},
+	{22, 23, 16, 17},
+	{30, 31, 24, 25}
+    },
+    {
+	{7, 0, 1, 2},
+	{15, 8, 9, 10},
+	{23, 16, 17, 18},
+	{31, 24, 25, 26}
+    },
+    {
+	{8, 9, 10, 11},
+	{16, 17, 18, 19},
+	{24, 25, 26, 27},
+	{32, 33, 34, 35}
+    },
+    {
+	{9, 10, 11, 12},
+	{17, 18, 19, 20},
+	{25, 26, 27, 28},
+	{33, 34, 35, 36}
+    },
+    {
+	{10, 11, 12, 13},
+	{18, 19, 20, 21},
+	{26, 27, 28, 29},
+	{34, 35, 36, 37}
+    },
+    {
+	{11, 12, 13, 14},
+	{19, 20, 21, 22},
+	{27, 28, 29, 30},
+	{35, 36, 37, 38}
+    },
+    {
+	{12, 13, 14, 15},
+	{20, 21, 22, 23},
+	{28, 29, 30, 31},
+	{36, 37, 38, 39}
+    },
+    {
+	{13, 14, 15, 8},
+	{21, 22, 23, 16},
+	{29, 30, 31, 24},
+	{37, 38, 39, 32}
+    },
+    {
+	{14, 15, 8, 9},
+	{22, 23, 16, 17},
+	{30, 31, 24, 25},
+	{38, 39, 32, 33}
+    },
+    {
+	{15, 8, 9, 10},
+	{23, 16, 17, 18},
+	{31, 24, 25, 26},
+	{39, 32, 33, 34}
+    },
+    {
+	{16, 17, 18, 19},
+	{24, 25, 26, 27},
+	{32, 33, 34, 35},
+	{40, 41, 42, 43}
+    },
+    {
+	{17, 18, 19, 20},
+	{25, 26, 27, 28},
+	{33, 34, 35, 36},
+	{41, 42, 43, 44}
+    },
+    {
+	{18, 19, 20, 21},
+	{26, 27, 28, 29},
+	{34, 35, 36, 37},
+	{42, 43, 44, 45}
+    },
+    {
+	{19, 20, 21, 22},
+	{27, 28, 29, 30},
+	{35, 36, 37, 38},
+	{43, 44, 45, 46}
+    },
+    {
+	{20, 21, 22, 23},
+	{28, 29, 30, 31},
+	{36, 37, 38, 39},
+	{44, 45, 46, 47}
+    },
+    {
+	{21, 22, 23, 16},
+	{29, 30, 31, 24},
+	{37, 38, 39, 32},
+	{45, 46, 47, 40}
+    },
+    {
+	{22, 23, 16, 17},
+	{30, 31, 24, 25},
+	{38, 39, 32, 33},
+	{46, 47, 40, 41}
+    },
+    {
+	{23, 16, 17, 18},
+	{31, 24, 25, 26},
+	{39, 32, 33, 34},
+	{47, 40, 41, 42}
+    },
+    {
+	{24, 25, 26, 27},
+	{32, 33, 34, 35},
+	{40, 41, 42, 43},
+	{48, 49, 50, 51}
+    },
+    {
+	{25, 26, 27, 28},
+	{33, 34, 35, 36},
+	{41, 42, 43, 44},
+	{49, 50, 51, 52}
+    },
+    {
+	{26, 27, 28, 29},
+	{34, 35, 36, 37},
+	{42, 43, 44, 45},
+	{50, 51, 52, 53}
+    },
+    {
+	{27, 28, 29, 30},
+	{35, 36, 37, 38},
+	{43, 44, 45, 46},
+	{51, 52, 53, 54}
+    },
+    {
+	{28, 29, 30, 31},
+	{36, 37, 38, 39},
+	{44, 45, 46, 47},
+	{52, 53, 54, 55}
+    },
+    {
+	{29, 30, 31, 24},
+	{37, 38, 39, 32},
+	{45, 46, 47, 40},
+	{53, 54, 55, 48}
+    },
+    {
+	{30, 31, 24, 25},
+	{38, 39, 32, 33},
+	{46, 47, 40, 41},
+	{54, 55, 48, 49}
+    },
+    {
+	{31, 24, 25, 26},
+	{39, 32, 33, 34},
+	{47, 40, 41, 42},
+	{55, 48, 49, 50}
+    },
+    {
+	{32, 33, 34, 35},
+	{40, 41, 42, 43},
+	{48, 49, 50, 51},
+	{56, 57, 58, 59}
+    },
+    {
+	{33, 34, 35, 36},
+	{41, 42, 43, 44},
+	{49, 50, 51, 52},
+	{57, 58, 59, 60}
+    },
+    {
+	{34, 35, 36, 37},
+	{42, 43, 44, 45},
+	{50, 51, 52, 53},
+	{58, 59, 60, 61}
+    },
+    {
+	{35, 36, 37, 38},
+	{43, 44, 45, 46},
+	{51, 52, 53, 54},
+	{59, 60, 61, 62}
+    },
+    {
+	{36, 37, 38, 39},
+	{44, 45, 46, 47},
+	{52, 53, 54, 55},
+	{60, 61, 62, 63}
+    },
+    {
+	{37, 38, 39, 32},
+	{45, 46, 47, 40},
+	{53, 54, 55, 48},
+	{61, 62, 63, 56}
+    },
+    {
+	{38, 39, 32, 33},
+	{46, 47, 40, 41},
+	{54, 55, 48, 49},
+	{62, 63, 56, 57}
+    },
+    {
+	{39, 32, 33, 34},
+	{47, 40, 41, 42},
+	{55, 48, 49, 50},
+	{63, 56, 57, 58}
+    },
+    {
+	{40, 41, 42, 43},
+	{48, 49, 50, 51},
+	{56, 57, 58, 59},
+	{64, 65, 66, 67}
+    },
+    {
+	{41, 42, 43, 44},
+	{49, 50, 51, 52},
+	{57, 58, 59, 60},
+	{65, 66, 67, 68}
+    },
+    {
+	{42, 43, 44, 45},
+	{50, 51, 52, 53},
+	{58, 59, 60, 61},
+	{66, 67, 68, 69}
+    },
+    {
+	{43, 44, 45, 46},
+	{51, 52, 53, 54},
+	{59, 60, 61, 62},
+	{67, 68, 69, 70}
+    },
+    {
+	{44, 45, 46, 47},
+	{52, 53, 54, 55},
+	{60, 61, 62, 63},
+	{68, 69, 70, 71}
+    },
+    {
+	{45, 46, 47, 40},
+	{53, 54, 55, 48},
+	{61, 62, 63, 56},
+	{69, 70, 71, 64}
+    },
+    {
+	{46, 47, 40, 41},
+	{54, 55, 48, 49},
+	{62, 63, 56, 57},
+	{70, 71, 64, 65}
+    },
+    {
+	{47, 40, 41, 42},
+	{55, 48, 49, 50},
+	{63, 56, 57, 58},
+	{71, 64, 65, 66}
+    },
+    {
+	{48, 49, 50, 51},
+	{56, 57, 58, 59},
+	{64, 65, 66, 67},
+	{72, 73, 74, 75}
+    },
+    {
+	{49, 50, 51, 52},
+	{57, 58, 59, 60},
+	{65, 66, 67, 68},
+	{73, 74, 75, 76}
+    },
+    {
+	{50, 51, 52, 53},
+	{58, 59, 60, 61},
+	{66, 67, 68, 69},
+	{74, 75, 76, 77}
+    },
+    {
+	{51, 52, 53, 54},
+	{59, 60, 61, 62},
+	{67, 68, 69, 70},
+	{75, 76, 77, 78}
+    },
+    {
+	{52, 53, 54, 55},
+	{60, 61, 62, 63},
+	{68, 69, 70, 71},
+	{76, 77, 78, 79}
+    },
+    {
+	{53, 54, 55, 48},
+	{61, 62, 63, 56},
+	{69, 70, 71, 64},
+	{77, 78, 79, 72}
+    },
+    {
+	{54, 55, 48, 49},
+	{62, 63, 56, 57},
+	{70, 71, 64, 65},
+	{78, 79, 72, 73}
+    },
+    {
+	{55, 48, 49, 50},
+	{63, 56, 57, 58},
+	{71, 64, 65, 66},
+	{79, 72, 73, 74}
+    },
+    {
+	{56, 57, 58, 59},
+	{64, 65, 66, 67},
+	{72, 73, 74, 75},
+	{80, 81, 82, 83}
+    },
+    {
+	{57, 58, 59, 60},
+	{65, 66, 67, 68},
+	{73, 74, 75, 76},
+	{81, 82, 83, 84}
+    },
+    {
+	{58, 59, 60, 61},
+	{66, 67, 68, 69},
+	{74, 75, 76, 77},
+	{82, 83, 84, 85}
+    },
+    {
+	{59, 60, 61, 62},
+	{67, 68, 69, 70},
+	{75, 76, 77, 78},
+	{83, 84, 85, 86}
+    },
+    {
+	{60, 61, 62, 63},
+	{68, 69, 70, 71},
+	{76, 77, 78, 79},
+	{84, 85, 86, 87}
+    },
+    {
+	{61, 62, 63, 56},
+	{69, 70, 71, 64},
+	{77, 78, 79, 72},
+	{85, 86, 87, 80}
+    },
+    {
+	{62, 63, 56, 57},
+	{70, 71, 64, 65},
+	{78, 79, 72, 73},
+	{86, 87, 80, 81}
+    },
+    {
+	{63, 56, 57, 58},
+	{71, 64, 65, 66},
+	{79, 72, 73, 74},
+	{87, 80, 81, 82}
+    },
+    {
+	{64, 65, 66, 67},
+	{72, 73, 74, 75},
+	{80, 81, 82, 83},
+	{88, 89, 90, 91}
+    },
+    {
+	{65, 66, 67, 68},
+	{73, 74, 75, 76},
+	{81, 82, 83, 84},
+	{89, 90, 91, 92}
+    },
+    {
+	{66, 67, 68, 69},
+	{74, 75, 76, 77},
+	{82, 83, 84, 85},
+	{90, 91, 92, 93}
+    },
+    {
+	{67, 68, 69, 70},
+	{75, 76, 77, 78},
+	{83, 84, 85, 86},
+	{91, 92, 93, 94}
+    },
+    {
+	{68, 69, 70, 71},
+	{76, 77, 78, 79},
+	{84, 85, 86, 87},
+	{92, 93, 94, 95}
+    },
+    {
+	{69, 70, 71, 64},
+	{77, 78, 79, 72},
+	{85, 86, 87, 80},
+	{93, 94, 95, 88}
+    },
+    {
+	{70, 71, 64, 65},
+	{78, 79, 72, 73},
+	{86, 87, 80, 81},
+	{94, 95, 88, 89}
+    },
+    {
+	{71, 64, 65, 66},
+	{79, 72, 73, 74},
+	{87, 80, 81, 82},
+	{95, 88, 89, 90}
+    },
+    {
+	{72, 73, 74, 75},
+	{80, 81, 82, 83},
+	{88, 89, 90, 91},
+	{0, 1, 2, 3}
+    },
+    {
+	{73, 74, 75, 76},
+	{81, 82, 83, 84},
+	{89, 90, 91, 92},
+	{1, 2, 3, 4}
+    },
+    {
+	{74, 75, 76, 77},
+	{82, 83, 84, 85},
+	{90, 91, 92, 93},
+	{2, 3, 4, 5}
+    },
+    {
+	{75, 76, 77, 78},
+	{83, 84, 85, 86},
+	{91, 92, 93, 94},
+	{3, 4, 5, 6}
+    },
+    {
+	{76, 77, 78, 79},
+	{84, 85, 86, 87},
+	{92, 93, 94, 95},
+	{4, 5, 6, 7}
+    },
+    {
+	{77, 78, 79, 72},
+	{85, 86, 87, 80},
+	{93, 94, 95, 88},
+	{5, 6, 7, 0}
+    },
+    {
+	{78, 79, 72, 73},
+	{86, 87, 80, 81},
+	{94, 95, 88, 89},
+	{6, 7, 0, 1}
+    },
+    {
+	{79, 72, 73, 74},
+	{87, 80, 81, 82},
+	{95, 88, 89, 90},
+	{7, 0, 1, 2}
+    },
+    {
+	{80, 81, 82, 83},
+	{88, 89, 90, 91},
+	{0, 1, 2, 3},
+	{8, 9, 10, 11}
+    },
+    {
+	{81, 82, 83, 84},
+	{89, 90, 91, 92},
+	{1, 2, 3, 4},
+	{9, 10, 11, 12}
+    },
+    {
+	{82, 83, 84, 85},
+	{90, 91, 92, 93},
+	{2, 3, 4, 5},
+	{10, 11, 12, 13}
+    },
+    {
+	{83, 84, 85, 86},
+	{91, 92, 93, 94},
+	{3, 4, 5, 6},
+	{11, 12, 13, 14}
+    },
+    {
+	{84, 85, 86, 87},
+	{92, 93, 94, 95},
+	{4, 5, 6, 7},
+	{12, 13, 14, 15}
+    },
+    {
+	{85, 86, 87, 80},
+	{93, 94, 95, 88},
+	{5, 6, 7, 0},
+	{13, 14, 15, 8}
+    },
+    {
+	{86, 87, 80, 81},
+	{94, 95, 88, 89},
+	{6, 7, 0, 1},
+	{14, 15, 8, 9}
+    },
+    {
+	{87, 80, 81, 82},
+	{95, 88, 89, 90},
+	{7, 0, 1, 2},
+	{15, 8, 9, 10}
+    },
+    {
+	{88, 89, 90, 91},
+	{0, 1, 2, 3},
+	{8, 9, 10, 11},
+	{16, 17, 18, 19}
+    },
+    {
+	{89, 90, 91, 92},
+	{1, 2, 3, 4},
+	{9, 10, 11, 12},
+	{17, 18, 19, 20}
+    },
+    {
+	{90, 91, 92, 93},
+	{2, 3, 4, 5},
+	{10, 11, 12, 13},
+	{18, 19, 20, 21}
+    },
+    {
+	{91, 92, 93, 94},
+	{3, 4, 5, 6},
+	{11, 12, 13, 14},
+	{19, 20, 21, 22}
+    },
+    {
+	{92, 93, 94, 95},
+	{4, 5, 6, 7},
+	{12, 13, 14, 15},
+	{20, 21, 22, 23}
+    },
+    {
+	{93, 94, 95, 88},
+	{5, 6, 7, 0},
+	{13, 14, 15, 8},
+	{21, 22, 23, 16}
+    },
+    {
+	{94, 95, 88, 89},
+	{6, 7, 0, 1},
+	{14, 15, 8, 9},
+	{22, 23, 16, 17}
+    },
+    {
+	{95, 88, 89, 90},
+	{7, 0, 1, 2},
+	{15, 8, 9, 10},
+	{23, 16, 17, 18}
+    }
+};
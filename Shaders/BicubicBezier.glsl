@@ -1,16 +1,118 @@
+// The METHODs are for bicubic patches; those of other degrees are always evaluated by BezierPatch()
+#define BICUBIC (DEGREE_U == 3 && DEGREE_V == 3)
+
+// Control points in DEGREE_U + 1 rows of DEGREE_V + 1, the rows running along uv.x
 struct BicubicPatch
 {
-	#if METHOD == 2
+	#if METHOD == 2 && BICUBIC
 		mat4 Cx, Cy, Cz;
 	#else
-		vec3 c[16];
-	#endif // METHOD == 2
+		vec3 c[PATCH_VERTICES];
+	#endif // METHOD == 2 && BICUBIC
 };
 
+// A patch packed into as few vec4s as it fills, so that the fragment shader's inputs can take patches of up to 36
+// control points, which as vec3s would take a location each
+#if METHOD == 2 && BICUBIC
+	const int packedPatchSize = 12;
+#else
+	const int packedPatchSize = (PATCH_VERTICES * 3 + 3) / 4;
+#endif // METHOD == 2 && BICUBIC
+
+void
+PackPatch(const in BicubicPatch p, out vec4 packedPatch[packedPatchSize])
+{
+	#if METHOD == 2 && BICUBIC
+		for (int i = 0; i < 4; ++i)
+		{
+			packedPatch[i] = p.Cx[i];
+			packedPatch[4 + i] = p.Cy[i];
+			packedPatch[8 + i] = p.Cz[i];
+		}
+	#else
+		packedPatch[packedPatchSize - 1] = vec4(0);
+		for (int i = 0; i < PATCH_VERTICES * 3; ++i)
+			packedPatch[i / 4][i % 4] = p.c[i / 3][i % 3];
+	#endif // METHOD == 2 && BICUBIC
+}
+
+BicubicPatch
+UnpackPatch(const in vec4 packedPatch[packedPatchSize])
+{
+	BicubicPatch p;
+	#if METHOD == 2 && BICUBIC
+		for (int i = 0; i < 4; ++i)
+		{
+			p.Cx[i] = packedPatch[i];
+			p.Cy[i] = packedPatch[4 + i];
+			p.Cz[i] = packedPatch[8 + i];
+		}
+	#else
+		for (int i = 0; i < PATCH_VERTICES * 3; ++i)
+			p.c[i / 3][i % 3] = packedPatch[i / 4][i % 4];
+	#endif // METHOD == 2 && BICUBIC
+	return p;
+}
+
+#if !BICUBIC
+	const int maxDegree = (DEGREE_U > DEGREE_V) ? DEGREE_U : DEGREE_V;
+
+	// Bernstein polynomials of a degree at t, built up a degree at a time like BernsteinBasis() in Tessellator.hh,
+	// and their derivatives, from the polynomials one degree lower
+	void
+	BernsteinBasis(int degree, float t, out float basis[maxDegree + 1], out float derivs[maxDegree + 1])
+	{
+		float s = 1 - t;
+
+		basis[0] = 1;
+		for (int k = 1; k <= degree; ++k)
+		{
+			if (k == degree)
+				for (int j = 0; j <= degree; ++j)
+					derivs[j] = degree * (((j > 0) ? basis[j - 1] : 0) - ((j < degree) ? basis[j] : 0));
+
+			basis[k] = t * basis[k - 1];
+			for (int j = k - 1; j > 0; --j)
+				basis[j] = s * basis[j] + t * basis[j - 1];
+			basis[0]*= s;
+		}
+	}
+
+	// Same as EvaluateBezierPatch() in Tessellator.hh, with the normal from the tangents like METHOD 3
+	vec3
+	BezierPatch(vec2 uv, out vec3 normal, const in BicubicPatch p)
+	{
+		float basisX[maxDegree + 1], derivsX[maxDegree + 1];
+		float basisY[maxDegree + 1], derivsY[maxDegree + 1];
+		BernsteinBasis(DEGREE_V, uv.x, basisX, derivsX);
+		BernsteinBasis(DEGREE_U, uv.y, basisY, derivsY);
+
+		vec3 position = vec3(0), tanX = vec3(0), tanY = vec3(0);
+		for (int u = 0; u <= DEGREE_U; ++u)
+		{
+			vec3 row = vec3(0), rowTan = vec3(0);
+			for (int v = 0; v <= DEGREE_V; ++v)
+			{
+				row+= basisX[v] * p.c[u * (DEGREE_V + 1) + v];
+				rowTan+= derivsX[v] * p.c[u * (DEGREE_V + 1) + v];
+			}
+
+			position+= basisY[u] * row;
+			tanX+= basisY[u] * rowTan;
+			tanY+= derivsY[u] * row;
+		}
+
+		normal = cross(tanX, tanY);
+		return position;
+	}
+#endif // !BICUBIC
+
 vec3
 BicubicBezier(in vec2 uv, out vec3 normal, const in BicubicPatch p)
 {
-	#if METHOD == 1
+	#if !BICUBIC
+		return BezierPatch(uv, normal, p);
+	#elif METHOD == 1
 		vec3 u3 = vec3(uv.x);
 		vec3 uComp3 = vec3(1 - uv.x);
 		vec3 v3 = vec3(uv.y);
@@ -38,16 +140,12 @@ BicubicBezier(in vec2 uv, out vec3 normal, const in BicubicPatch p)
 
 		normal = cross(vc[1] - vc[0], uc[1] - uc[0]);
 		return (1 - uv.y) * uc[0] + uv.y * uc[1];
-	#endif // METHOD == 1
-
-	#if METHOD == 2
+	#elif METHOD == 2
 		vec4 up = vec4(uv.x*uv.x*uv.x, uv.x*uv.x, uv.x, 1);
 		vec4 vp = vec4(uv.y*uv.y*uv.y, uv.y*uv.y, uv.y, 1);
 
 		return vec3(dot(p.Cx * vp, up), dot(p.Cy * vp, up), dot(p.Cz * vp, up));
-	#endif // METHOD == 2
-
-	#if METHOD == 3
+	#elif METHOD == 3
 		vec2 N0 = -3 * (1 - uv) * (1 - uv);
 		vec2 N1 =  3 * (1 - uv) * (1 - uv) - 6 * uv * (1 - uv);
 		vec2 N2 =  6 *      uv  * (1 - uv) - 3 * uv * uv;
@@ -72,5 +170,5 @@ BicubicBezier(in vec2 uv, out vec3 normal, const in BicubicPatch p)
 				(P0.x * p.c[ 4] + P1.x * p.c[ 5] + P2.x * p.c[ 6] + P3.x * p.c[ 7]) * P1.y +
 				(P0.x * p.c[ 8] + P1.x * p.c[ 9] + P2.x * p.c[10] + P3.x * p.c[11]) * P2.y +
 				(P0.x * p.c[12] + P1.x * p.c[13] + P2.x * p.c[14] + P3.x * p.c[15]) * P3.y;
-	#endif // METHOD == 3
+	#endif // METHOD
 }
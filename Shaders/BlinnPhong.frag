@@ -4,12 +4,7 @@ in vec2 TexCoord;
 in vec3 WorldPosition;
 in vec3 Normal;
 
-uniform float AmbientIntensity;
 uniform sampler2D Texture;
-uniform int TextureRepeat;
-uniform vec3 LightPosition;
-uniform float LightIntensity;
-uniform float Shininess;
 
 void
 main()
@@ -19,7 +14,8 @@ main()
 	vec3 viewDir = normalize(-WorldPosition);
 
 	float diffuse = max(dot(lightDir, normal), 0);
-	vec3 diffuseColor = texture(Texture, TexCoord * TextureRepeat).rgb;
+	float checker = texture(Texture, TexCoord * TextureRepeat).r;
+	vec3 diffuseColor = mix(DiffuseColor2, DiffuseColor1, checker);
 
 	vec3 halfDir = normalize(lightDir + viewDir);
 	float specAngle = max(dot(halfDir, normal), 0);
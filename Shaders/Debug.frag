@@ -3,10 +3,7 @@ layout (location = 0) out vec4 FragColor;
 #if SHOW_ERROR
 	in vec2 TexCoord;
 	in vec3 WorldPosition;
-	in BicubicPatch DebugPatch;
-
-	uniform ivec2 ViewportSize;
-	uniform mat4 ProjectionMatrix;
+	flat in vec4 DebugPatch[packedPatchSize];
 #endif // SHOW_ERROR
 in vec3 Normal;
 
@@ -15,7 +12,7 @@ main()
 {
 	#if SHOW_ERROR
 		vec3 normal;
-		vec3 limitPos = BicubicBezier(TexCoord, normal, DebugPatch);
+		vec3 limitPos = BicubicBezier(TexCoord, normal, UnpackPatch(DebugPatch));
 		vec4 limitScreenPos = ProjectionMatrix * vec4(limitPos, 1);
 		limitPos = limitScreenPos.xyz / limitScreenPos.w;
 
@@ -25,14 +22,19 @@ main()
 		vec2 halfViewport = ViewportSize * 0.5;
 
 		float error = distance(limitPos.xy * halfViewport, approxPos.xy * halfViewport);
-		if (error < 0.1)
-			FragColor = vec4(0.4, 0.4, 0.4, 1);
-		else if (error < 0.5)
-			FragColor = vec4(0, 0, 1, 1);
-		else if (error < 1.0)
-			FragColor = vec4(0, 1, 0, 1);
-		else
-			FragColor = vec4(1, 0, 0, 1);
+		#if SHOW_ERROR == 2
+			// Raw error in pixels, for calibrating against a float render target
+			FragColor = vec4(error, 0, 0, 1);
+		#else
+			if (error < 0.1)
+				FragColor = vec4(0.4, 0.4, 0.4, 1);
+			else if (error < 0.5)
+				FragColor = vec4(0, 0, 1, 1);
+			else if (error < 1.0)
+				FragColor = vec4(0, 1, 0, 1);
+			else
+				FragColor = vec4(1, 0, 0, 1);
+		#endif // SHOW_ERROR == 2
 	#endif // SHOW_ERROR
 
 	#if SHOW_NORMAL
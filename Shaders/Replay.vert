@@ -0,0 +1,27 @@
+// Replays a tessellation captured by iPASS.tese with CAPTURE, in model space, as plain triangles with the same outputs
+// as iPASS.tese
+layout (location = 0) in vec3 Position;
+layout (location = 1) in vec3 ModelNormal;
+layout (location = 2) in vec2 ModelTexCoord;
+
+out vec2 TexCoord;
+out vec3 WorldPosition;
+out vec3 Normal;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+void
+main()
+{
+	TexCoord = ModelTexCoord;
+	WorldPosition = (ModelViewMatrix * vec4(Position, 1)).xyz;
+
+	// The cofactor matrix, which is what taking the cross product of the tangents in eye space comes to
+	mat3 linear = mat3(ModelViewMatrix);
+	Normal = determinant(linear) * transpose(inverse(linear)) * ModelNormal;
+
+	gl_Position = ProjectionMatrix * vec4(WorldPosition, 1);
+}
@@ -0,0 +1,109 @@
+// Storage blocks of the compute pre-pass; bindings must match the STORAGE_ enum in Main.cc
+
+layout (std430, binding = 0) buffer ControlPointBuffer
+{
+	#if QUANTIZED
+		uint ControlPoints[]; // Pairs of 16-bit coordinates of each patch's own copies, see QuantizeControlPoints()
+	#else
+		float ControlPoints[]; // PatchModel::vertices in Main.cc
+	#endif // QUANTIZED
+};
+
+layout (std430, binding = 1) buffer PatchIndexBuffer
+{
+	uint PatchIndices[]; // PatchModel::indices
+};
+
+// SubLiME's unirange bounds for NumSlefeDivs pieces, DEGREE_V's then DEGREE_U's, or bsprange-3 ones with BSPLINE, in
+// the order of the range files. See LoadSlefeTable() in Main.cc.
+layout (std430, binding = 2) buffer SlefeTableBuffer
+{
+	float SlefeTable[];
+};
+
+layout (std430, binding = 3) buffer SlefePointBuffer
+{
+	vec4 SlefePoints[];
+};
+
+layout (std430, binding = 4) buffer PatchLevelBuffer
+{
+	float PatchLevels[];
+};
+
+// Float bits, so that patches can atomicMax() their levels into shared vertices
+layout (std430, binding = 5) buffer VertexTessLevelBuffer
+{
+	uint VertexTessLevels[];
+};
+
+// DrawElementsIndirectCommand in Main.cc
+layout (std430, binding = 6) buffer DrawCommandBuffer
+{
+	uint DrawCount;
+	uint DrawInstanceCount;
+	uint DrawFirstIndex;
+	int DrawBaseVertex;
+	uint DrawBaseInstance;
+};
+
+layout (std430, binding = 7) buffer VisibleIndexBuffer
+{
+	uint VisibleIndices[];
+};
+
+// ControlPointBox in Main.cc, with the origin, step and error of each patch
+layout (std430, binding = 8) buffer ControlPointBoxBuffer
+{
+	float ControlPointBoxes[];
+};
+
+const int SLEFE_LOWER = 0, SLEFE_UPPER = 1; // Slefe::LOWER and Slefe::UPPER
+
+vec3
+GetControlPointBoxVector(int patchIndex, int row)
+{
+	int i = (patchIndex * 3 + row) * 3;
+	return vec3(ControlPointBoxes[i], ControlPointBoxes[i + 1], ControlPointBoxes[i + 2]);
+}
+
+vec3
+GetControlPoint(int patchIndex, int k)
+{
+	#if QUANTIZED
+		vec3 value;
+		for (int dim = 0; dim < 3; ++dim)
+		{
+			int i = (patchIndex * PATCH_VERTICES + k) * 3 + dim;
+			value[dim] = float((ControlPoints[i / 2] >> ((i % 2) * 16)) & 0xffffu);
+		}
+		return GetControlPointBoxVector(patchIndex, 0) + GetControlPointBoxVector(patchIndex, 1) * value;
+	#else
+		int vertex = int(PatchIndices[patchIndex * PATCH_VERTICES + k]);
+		return vec3(ControlPoints[vertex * 3], ControlPoints[vertex * 3 + 1], ControlPoints[vertex * 3 + 2]);
+	#endif // QUANTIZED
+}
+
+// Largest difference of the patch's decoded control points from the model's, in each axis
+vec3
+GetControlPointError(int patchIndex)
+{
+	#if QUANTIZED
+		return GetControlPointBoxVector(patchIndex, 2);
+	#else
+		return vec3(0);
+	#endif // QUANTIZED
+}
+
+// Laid out like Slefe::bounds, with room for MAX_SLEFE_DIVS so the buffer doesn't depend on NumSlefeDivs
+int
+GetSlefePointIndex(int patchIndex, int bound, int u, int v)
+{
+	return ((patchIndex * 2 + bound) * (MAX_SLEFE_DIVS + 1) + u) * (MAX_SLEFE_DIVS + 1) + v;
+}
+
+vec3
+GetSlefePoint(int patchIndex, int bound, int u, int v)
+{
+	return SlefePoints[GetSlefePointIndex(patchIndex, bound, u, v)].xyz;
+}
@@ -0,0 +1,29 @@
+// Must match FrameUniforms, MaterialUniforms and TessUniforms in Main.cc
+
+layout (std140) uniform FrameUniforms
+{
+	mat4 ModelViewMatrix;
+	mat4 ProjectionMatrix;
+	vec3 LightPosition; // Eye space
+	ivec2 ViewportSize;
+	int QuantizedControlPoints; // Decoded with their patch's box in iPASS.vert
+};
+
+layout (std140) uniform MaterialUniforms
+{
+	float AmbientIntensity;
+	float LightIntensity;
+	float Shininess;
+	int TextureRepeat;
+	vec3 DiffuseColor1;
+	vec3 DiffuseColor2;
+};
+
+// For GPU_TESS_LEVELS and the compute pre-pass
+layout (std140) uniform TessUniforms
+{
+	int NumSlefeDivs;
+	int FirstPatch;
+	float PixelAccuracy;
+	float MysteryFactor;
+};
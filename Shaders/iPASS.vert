@@ -1,12 +1,33 @@
-in vec4 Position;
-in float TessLevel;
+layout (location = 0) in vec4 Position;
+layout (location = 1) in float TessLevel;
 out float PatchTessLevels;
 
-uniform mat4 ModelViewMatrix;
+// Quantized control points are drawn as arrays of each patch's own copies, see QuantizeControlPoints() and
+// BindQuantizedControlPoints() in Main.cc
+uniform samplerBuffer ControlPointBoxes; // Origin, step and error of each patch
+uniform usamplerBuffer SharedVertices; // The model vertex of each copy
+uniform samplerBuffer SharedTessLevels;
 
 void
 main()
 {
-    gl_Position = ModelViewMatrix * Position;
-    PatchTessLevels = TessLevel;
+	vec4 modelPosition = Position;
+	float tessLevel = TessLevel;
+	if (QuantizedControlPoints != 0)
+	{
+		int patchIndex = gl_VertexID / PATCH_VERTICES;
+		vec3 origin = texelFetch(ControlPointBoxes, patchIndex * 3).xyz;
+		vec3 stepSize = texelFetch(ControlPointBoxes, patchIndex * 3 + 1).xyz;
+		modelPosition = vec4(origin + stepSize * Position.xyz, 1);
+		tessLevel = texelFetch(SharedTessLevels, int(texelFetch(SharedVertices, gl_VertexID).r)).r;
+	}
+
+	// Captured tessellations stay in model space, so they can be replayed from any view, see CapturePatches() in
+	// Main.cc
+	#if CAPTURE
+		gl_Position = modelPosition;
+	#else
+		gl_Position = ModelViewMatrix * modelPosition;
+	#endif // CAPTURE
+    PatchTessLevels = tessLevel;
 }
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "TessLevels.hh"
+#include "Tessellator.hh"
+#include "ParallelFor.hh"
+#include <algorithm>
+#include <random>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// The views the mystery factors are fitted over and the CPU reference measures, and the fit itself
+
+static const float minMysteryFactor = 0.1;
+static const float maxMysteryFactor = 4; // Past this the levels are clamped to maxTessGenLevel and no factor helps
+static const unsigned numFactorBisections = 8;
+
+// What the views orbit: the mean height of the control points, on the y axis
+inline glm::vec3
+GetModelCentroid(const PatchModel &model)
+{
+	glm::vec3 centroid = glm::vec3(0);
+	for (unsigned i = 0; i < model.numVertices; ++i)
+		centroid+= glm::vec3(0/*model.vertices[i][0]*/, model.vertices[i][1], 0/*model.vertices[i][2]*/);
+	return centroid / float(model.numVertices);
+}
+
+// Model view matrix orbiting the model at a random angle and distance, within the range of the camera animation
+inline glm::mat4
+GetRandomView(std::mt19937 &random, const glm::vec3 &modelCentroid)
+{
+	std::uniform_real_distribution<float> angles(-180, 180), offsets(-1, 1), distances(2.4, 15);
+
+	glm::mat4 modelViewMatrix = glm::translate(glm::mat4(1), glm::vec3(offsets(random), offsets(random),
+	                                                                   -distances(random)));
+	modelViewMatrix = glm::rotate(modelViewMatrix, glm::radians(angles(random) / 2), glm::vec3(1, 0, 0));
+	modelViewMatrix = glm::rotate(modelViewMatrix, glm::radians(angles(random)), glm::vec3(0, 1, 0));
+	return glm::translate(modelViewMatrix, -modelCentroid);
+}
+
+// Smallest factor from fittedFactor up to maxMysteryFactor for which measureError(factor), the error of one view, is
+// within pixelAccuracy. Views that fail even at maxMysteryFactor are saturated and leave fittedFactor as it is.
+template<typename MeasureErrorT>
+inline float
+FitMysteryFactor(float fittedFactor, float pixelAccuracy, MeasureErrorT measureError, bool &saturated)
+{
+	saturated = false;
+	if (measureError(fittedFactor) <= pixelAccuracy)
+		return fittedFactor;
+
+	if (measureError(maxMysteryFactor) > pixelAccuracy)
+	{
+		saturated = true;
+		return fittedFactor;
+	}
+
+	float failingFactor = fittedFactor, passingFactor = maxMysteryFactor;
+	for (unsigned i = 0; i < numFactorBisections; ++i)
+	{
+		float factor = (failingFactor + passingFactor) / 2;
+		if (measureError(factor) <= pixelAccuracy)
+			passingFactor = factor;
+		else
+			failingFactor = factor;
+	}
+
+	return passingFactor;
+}
+
+inline void
+AccumulateTessError(TessError &total, const TessError &error)
+{
+	total.numTriangles+= error.numTriangles;
+	total.numSamples+= error.numSamples;
+	total.maxError = glm::max(total.maxError, error.maxError);
+	total.percentileError = glm::max(total.percentileError, error.percentileError);
+}
+
+// Tessellates count patches from first on the CPU like the GPU would with the given per-vertex levels, measuring the
+// triangles and the screen-space error of each patch against the model's own control points
+inline TessError
+MeasureReferenceError(const PatchModel &model, const float vertexTessLevels[maxModelVertices], int first, int count,
+		TessSpacing spacing, const glm::mat4 &modelViewProjection, const glm::vec2 &viewportSize, float percentile,
+		TessError patchErrors[maxModelPatches])
+{
+	ParallelFor(first, first + count, [&](int patchIndex)
+	{
+		glm::vec3 controlPoints[maxPatchVertices];
+		for (unsigned i = 0; i < model.GetNumPatchVertices(); ++i)
+		{
+			const float *vertex = model.vertices[model.GetPatchIndices(patchIndex)[i]];
+			controlPoints[i] = glm::vec3(vertex[0], vertex[1], vertex[2]);
+		}
+		if (model.bSpline)
+		{
+			glm::vec3 bSplinePoints[16];
+			std::copy(controlPoints, controlPoints + 16, bSplinePoints);
+			BSplineToBezier(bSplinePoints, controlPoints);
+		}
+
+		float outer[4], inner[2];
+		GetPatchTessLevels(model, vertexTessLevels, patchIndex, outer, inner);
+
+		QuadTessellation tess;
+		TessellateQuad(outer, inner, spacing, maxTessGenLevel, tess);
+
+		// The tess coordinates' x runs along the second index
+		patchErrors[patchIndex] = MeasureTessError(controlPoints, model.degree[1], model.degree[0], tess,
+		                                           modelViewProjection, viewportSize, percentile);
+	});
+
+	TessError viewError = {};
+	for (int patchIndex = first; patchIndex < first + count; ++patchIndex)
+		AccumulateTessError(viewError, patchErrors[patchIndex]);
+
+	return viewError;
+}
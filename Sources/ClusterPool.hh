@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Slefes.hh"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+
+// Spatial clusters of patches, and which of them a fixed pool of slots holds. Only the bookkeeping is here; the
+// uploads into the slots are the renderer's.
+
+static const unsigned clusterPatches = 8;
+
+struct PatchCluster
+{
+	AABB bounds; // Of the control points
+	std::vector<unsigned> vertices; // Model vertices of the patches, in the order of the slot
+	std::vector<unsigned> indices; // Of the patches, into vertices
+	std::vector<int> patches; // In the order of indices
+	int slot; // In the pool, or -1
+	unsigned lastDrawn; // Frame
+};
+
+// Spreads the low 10 bits of value 3 apart, for a Morton code
+inline unsigned
+SpreadBits(unsigned value)
+{
+	value = (value | (value << 16)) & 0x030000ff;
+	value = (value | (value << 8)) & 0x0300f00f;
+	value = (value | (value << 4)) & 0x030c30c3;
+	value = (value | (value << 2)) & 0x09249249;
+	return value;
+}
+
+// Groups count patches from first into clusters of up to clusterPatches, which follow each other along a Morton
+// curve through the bounds of the patches, so that each cluster is compact
+inline void
+ClusterPatches(const PatchModel &model, const AABB patchBounds[], int first, int count,
+		std::vector<PatchCluster> &clusters)
+{
+	AABB rangeBounds = {glm::vec3(INFINITY), glm::vec3(-INFINITY)};
+	for (int patchIndex = first; patchIndex < first + count; ++patchIndex)
+	{
+		rangeBounds.min = glm::min(rangeBounds.min, patchBounds[patchIndex].min);
+		rangeBounds.max = glm::max(rangeBounds.max, patchBounds[patchIndex].max);
+	}
+	glm::vec3 extent = glm::max(rangeBounds.max - rangeBounds.min, glm::vec3(std::numeric_limits<float>::min()));
+
+	std::vector<std::pair<unsigned, int>> patchKeys;
+	for (int patchIndex = first; patchIndex < first + count; ++patchIndex)
+	{
+		glm::vec3 center = (patchBounds[patchIndex].min + patchBounds[patchIndex].max) * 0.5f;
+		glm::vec3 cell = (center - rangeBounds.min) / extent * 1023.0f;
+		unsigned key = (SpreadBits(unsigned(cell.x)) << 2) | (SpreadBits(unsigned(cell.y)) << 1) |
+		               SpreadBits(unsigned(cell.z));
+		patchKeys.push_back({key, patchIndex});
+	}
+	std::sort(patchKeys.begin(), patchKeys.end());
+
+	clusters.clear();
+	for (size_t firstKey = 0; firstKey < patchKeys.size(); firstKey+= clusterPatches)
+	{
+		PatchCluster cluster = {{glm::vec3(INFINITY), glm::vec3(-INFINITY)}, {}, {}, {}, -1, 0};
+		std::map<unsigned, unsigned> slotVertices; // Of the model vertices
+		for (size_t i = firstKey; i < std::min(firstKey + clusterPatches, patchKeys.size()); ++i)
+		{
+			int patchIndex = patchKeys[i].second;
+			cluster.patches.push_back(patchIndex);
+			cluster.bounds.min = glm::min(cluster.bounds.min, patchBounds[patchIndex].min);
+			cluster.bounds.max = glm::max(cluster.bounds.max, patchBounds[patchIndex].max);
+
+			for (unsigned k = 0; k < model.GetNumPatchVertices(); ++k)
+			{
+				unsigned vertex = model.GetPatchIndices(patchIndex)[k];
+				auto slotVertex = slotVertices.insert({vertex, unsigned(cluster.vertices.size())});
+				if (slotVertex.second)
+					cluster.vertices.push_back(vertex);
+				cluster.indices.push_back(slotVertex.first->second);
+			}
+		}
+
+		clusters.push_back(std::move(cluster));
+	}
+}
+
+// The clusters whose bounds are in view, with the longest edge of their screen rects, largest first. Clusters with
+// corners behind the eye come first, since the rect doesn't bound their projection, and they're close anyway.
+inline void
+FindVisibleClusters(const std::vector<PatchCluster> &clusters, const glm::mat4 &modelViewProjection,
+		const glm::vec3 &halfWindowSize, std::vector<std::pair<float, int>> &visibleClusters)
+{
+	visibleClusters.clear();
+	for (int clusterIndex = 0; clusterIndex < int(clusters.size()); ++clusterIndex)
+	{
+		glm::vec3 vertices[8];
+		GetAABBVertices(clusters[clusterIndex].bounds, vertices);
+
+		bool clipped = false;
+		for (unsigned i = 0; i < 8; ++i)
+			clipped|= !((modelViewProjection * glm::vec4(vertices[i], 1)).w > 0);
+
+		SlefeBox box;
+		ComputeSlefeRect(box, vertices, 8, modelViewProjection, halfWindowSize);
+		const AABB &rect = box.screenAxisBox;
+		bool outside = false;
+		for (unsigned dim = 0; dim < threeD; ++dim)
+			outside|= (rect.max[dim] < 0 || rect.min[dim] > 2 * halfWindowSize[dim]);
+
+		if (clipped)
+			visibleClusters.push_back({INFINITY, clusterIndex});
+		else if (!outside)
+			visibleClusters.push_back({box.maxScreenEdge, clusterIndex});
+	}
+	std::sort(visibleClusters.begin(), visibleClusters.end(), std::greater<std::pair<float, int>>());
+}
+
+// An empty slot, or else the one whose cluster was drawn longest ago, before frame; -1 if all were drawn in frame
+inline int
+SelectPoolSlot(const std::vector<PatchCluster> &clusters, const std::vector<int> &poolClusters, unsigned frame)
+{
+	int slot = -1;
+	unsigned oldestFrame = frame;
+	for (int i = 0; i < int(poolClusters.size()); ++i)
+	{
+		int resident = poolClusters[i];
+		if (resident < 0)
+			return i;
+
+		if (clusters[resident].lastDrawn < oldestFrame)
+		{
+			slot = i;
+			oldestFrame = clusters[resident].lastDrawn;
+		}
+	}
+
+	return slot;
+}
@@ -301,6 +301,21 @@ public:
 		ImGui::DestroyContext();
 	}
 
+	// An invisible window whose context shares objects with the main one, for use on a worker thread
+	std::unique_ptr<GLFWwindow, void (*)(GLFWwindow *)>
+	CreateSharedContext()
+	{
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		std::unique_ptr<GLFWwindow, void (*)(GLFWwindow *)> context(glfwCreateWindow(1, 1, "", NULL, window.get()),
+		                                                             glfwDestroyWindow);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+		if (!context)
+			throw std::runtime_error("Could not create shared GLFW context");
+
+		return context;
+	}
+
 	virtual void OnResize(int width, int height) { glViewport(0, 0, width, height); }
 
 	virtual void OnKey(int /*key*/, int /*scancode*/, int /*action*/, int /*mods*/) { }
@@ -1,9 +1,30 @@
 #include "GLFWApp.hh"
 #include "ShaderProgram.hh"
+#include "UniformBuffer.hh"
 #include "AnimationCurve.hh"
-#include "../Data/Teapot.h"
+#include "ParallelFor.hh"
+#include "Tessellator.hh"
+#include "TripleBuffer.hh"
+#include "PatchModel.hh"
+#include "Slefes.hh"
+#include "TessLevels.hh"
+#include "OcclusionCulling.hh"
+#include "ClusterPool.hh"
+#include "Calibration.hh"
 #include <istream>
 #include <vector>
+#include <array>
+#include <algorithm>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+#include <random>
+#include <cerrno>
+#include <cstring>
+#include <sys/stat.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <SubLiME.h>
 #include <QuickHull.hpp>
@@ -24,32 +45,59 @@ using glm::value_ptr;
 using glm::min;
 using glm::max;
 
-static const GLuint threeD = 3;
-static const GLuint numCubicTerms = 4;
-static const GLuint maxSlefeDivs = 9;
 static const float minCameraZ = 0.1f;
 static const float maxCameraZ = 100.0f;
+static const char * const shaderCacheName = "PixAccCurvedSurf"; // Directory in the user's cache directory
 
-struct Slefe
+// std140 layouts of the blocks in Uniforms.glsl
+struct FrameUniforms
 {
-    enum {LOWER, UPPER, NUM_BOUNDS};
-    struct Bounds
-    {
-        vec3 points[maxSlefeDivs + 1][maxSlefeDivs + 1];
-    } bounds[NUM_BOUNDS];
-	vec3 midPoints[maxSlefeDivs][maxSlefeDivs][2][NUM_BOUNDS];
+	mat4 ModelViewMatrix;
+	mat4 ProjectionMatrix;
+	vec3 LightPosition;
+	float pad0;
+	glm::ivec2 ViewportSize;
+	GLint QuantizedControlPoints;
+	GLint pad1;
+};
+
+struct MaterialUniforms
+{
+	float AmbientIntensity;
+	float LightIntensity;
+	float Shininess;
+	GLint TextureRepeat;
+	vec3 DiffuseColor1;
+	float pad0;
+	vec3 DiffuseColor2;
+	float pad1;
 };
 
-struct AABB
+struct TessUniforms
 {
-	vec3 min, max;
+	GLint NumSlefeDivs;
+	GLint FirstPatch;
+	float PixelAccuracy;
+	float MysteryFactor;
 };
 
-struct SlefeBox
+// How a patch's quantized control points decode, laid out like the texels of BUFFER_CONTROL_POINT_BOXES: as origin
+// + step * value, which is exact in float. See QuantizeControlPoints().
+struct ControlPointBox
 {
-	struct AABB worldAxisBox;
-	struct AABB screenAxisBox;
-	float maxScreenEdge;
+	vec3 origin;
+	vec3 step;
+	vec3 error; // Largest difference of the decoded control points from PatchModel::vertices, in each axis
+};
+
+// glDrawElementsIndirect()'s arguments, as iPASS.comp writes them
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
 };
 
 // For debugging slefe tiles:
@@ -59,24 +107,87 @@ typedef quickhull::HalfEdgeMesh<float, size_t> HalfEdgeMesh;
 class PixAccCurvedSurf : public GLFWWindowedApp
 {
 	// Model data
-    enum {VERTEX_ARRAY_TEAPOT, VERTEX_ARRAY_DEBUG, NUM_VERTEX_ARRAYS};
+    enum {VERTEX_ARRAY_MODEL, VERTEX_ARRAY_DEBUG, VERTEX_ARRAY_CAPTURED, VERTEX_ARRAY_POOL, NUM_VERTEX_ARRAYS};
     GLuint vertexArrayObjects[NUM_VERTEX_ARRAYS];
     enum
     {
         BUFFER_CONTROL_POINTS,
         BUFFER_CONTROL_POINT_INDICES,
+		BUFFER_CONTROL_POINT_BOXES,
 		BUFFER_TESS_LEVELS,
+		BUFFER_DEPTH_OFFSETS, // Of the pre-pass, apart from the levels TESS_COMPUTE leaves in BUFFER_TESS_LEVELS
         BUFFER_DEBUG_VERTICES,
         BUFFER_DEBUG_INDICES,
+		BUFFER_SLEFE_BOXES,
+		BUFFER_SLEFE_TABLE,
+		BUFFER_SLEFE_POINTS,
+		BUFFER_PATCH_LEVELS,
+		BUFFER_VISIBLE_INDICES,
+		BUFFER_DRAW_COMMAND,
+		BUFFER_PATCH_LIST_INDICES,
+		BUFFER_DEPTH_READBACK,
+		BUFFER_CAPTURED_VERTICES,
+		BUFFER_POOL_CONTROL_POINTS,
+		BUFFER_POOL_TESS_LEVELS,
+		BUFFER_POOL_INDICES,
+		BUFFER_POOL_SLEFE_BOXES,
+		BUFFER_POOL_CONTROL_POINT_BOXES,
         NUM_BUFFERS
     };
     GLuint buffers[NUM_BUFFERS];
+	int modelIndex = MODEL_TEAPOT;
+	const char * const modelNames[NUM_MODELS] = {"Teapot (bicubic Bezier)", "Torus (B-spline)", "Gourd (4x2 Bezier)"};
+	const PatchModel *model = &patchModels[MODEL_TEAPOT];
     vec3 modelCentroid;
-    GLint patchRange[2] = {0, NumTeapotPatches};
+    GLint patchRange[2];
+	// With quantizeControlPoints, BUFFER_CONTROL_POINTS holds 16 bits per coordinate of each patch's own copies of its
+	// control points, in patch order, decoded with the patch's box
+	bool quantizeControlPoints = false;
+	vector<GLushort> quantizedVertices;
+	ControlPointBox controlPointBoxes[maxModelPatches];
+	vec3 quantizationError = vec3(0); // Largest of the patches' in each axis
 
 	// Shaders
-	unique_ptr<ShaderProgram> mainProgram;
+	ProgramPipeline mainPipeline;
+	ProgramPipeline depthPrepassPipeline;
+	ProgramPipeline capturePipeline, replayPipeline;
+	unique_ptr<ShaderProgram> replayProgram;
+	ShaderProgram *geometryProgram = nullptr; // Vertex and tessellation stages
+	ShaderProgram *fragmentProgram = nullptr;
+	std::map<string, unique_ptr<ShaderProgram>> stagePrograms; // By source file and preprocessor string
+	string shaderCacheDir; // Of the program binaries; empty if they aren't cached
+	std::mutex stageProgramsMutex;
+	unique_ptr<GLFWwindow, void (*)(GLFWwindow *)> precompileContext;
+	std::thread precompileThread;
+	std::atomic<bool> stopPrecompile{false};
     ShaderProgram debugProgram;
+	GLint debugColorLocation;
+	enum {ATTRIB_POSITION, ATTRIB_TESS_LEVEL}; // Layout locations in iPASS.vert
+	enum {REPLAY_ATTRIB_POSITION, REPLAY_ATTRIB_NORMAL, REPLAY_ATTRIB_TEX_COORD}; // And in Replay.vert
+	enum {UNIFORM_BLOCK_FRAME, UNIFORM_BLOCK_MATERIAL, UNIFORM_BLOCK_TESS};
+	UniformBuffer<FrameUniforms> frameUniforms;
+	UniformBuffer<MaterialUniforms> materialUniforms;
+	UniformBuffer<TessUniforms> tessUniforms;
+	enum
+	{
+		TEXTURE_UNIT_CHECKER,
+		TEXTURE_UNIT_SLEFE_BOXES,
+		TEXTURE_UNIT_CONTROL_POINT_BOXES,
+		TEXTURE_UNIT_SHARED_VERTICES,
+		TEXTURE_UNIT_SHARED_TESS_LEVELS
+	};
+	enum // Bindings in SlefeBuffers.glsl
+	{
+		STORAGE_CONTROL_POINTS,
+		STORAGE_PATCH_INDICES,
+		STORAGE_SLEFE_TABLE,
+		STORAGE_SLEFE_POINTS,
+		STORAGE_PATCH_LEVELS,
+		STORAGE_VERTEX_TESS_LEVELS,
+		STORAGE_DRAW_COMMAND,
+		STORAGE_VISIBLE_INDICES,
+		STORAGE_CONTROL_POINT_BOXES
+	};
 
 	// Camera
 	mat4 modelViewMatrix;
@@ -85,25 +196,99 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 	bool useMultiSampling;
 
 	// Tessellation
-	enum {TESS_IPASS, TESS_UNIFORM};
+	enum {TESS_IPASS, TESS_UNIFORM, TESS_IPASS_GPU, TESS_IPASS_PIPELINED, TESS_COMPUTE, NUM_TESS_MODES};
 	int tessMode = TESS_IPASS;
+	const char * const tessModeNames[NUM_TESS_MODES] =
+	{
+		"iPASS", "Uniform", "iPASS (GPU levels)", "iPASS (pipelined)", "iPASS (compute)"
+	};
 	float uniformLevel = 11;
-	Slefe slefes[NumTeapotPatches];
+	Slefe slefes[maxModelPatches];
 	bool slefesChanged = true;
+	bool singlePrecisionSlefes = false; // Built in float, with inflated bounds
+	struct
+	{
+		GLuint divs; // 0 until BenchmarkSlefeKernels() runs
+		double libraryMicroseconds, kernelMicroseconds, unfusedMicroseconds, floatMicroseconds; // Per patch
+		double maxDifference; // Between the library and the double kernels
+		double minFloatMargin;
+	} slefeBenchmark = {};
 	bool slefeBoxesChanged;
 	bool slefeTilesChanged;
 	GLuint numSlefeDivs = 3;
 	float pixelAccuracy = 0.5;
 	//float depthAccuracy = 0.01;
 	bool fracTessLevels = true;
-	SlefeBox pointSlefeBoxes[NumTeapotPatches][maxSlefeDivs + 1][maxSlefeDivs + 1];
-	SlefeBox tileSlefeBoxes[NumTeapotVertices][maxSlefeDivs][maxSlefeDivs];
-	vec3 pointBoxVertices[NumTeapotPatches][maxSlefeDivs + 1][maxSlefeDivs + 1][8];
-	vec3 tileBoxVertices[NumTeapotPatches][maxSlefeDivs][maxSlefeDivs][8];
+	float mysteryFactors[maxSlefeDivs + 1] = {1.5, 1.5, 1.5, 1.5, 1.5, 1.5, 1.5, 1.5, 1.5, 1.5}; // By numSlefeDivs
+	enum {CALIBRATE_NONE, CALIBRATE_DIVS, CALIBRATE_ALL_DIVS};
+	int calibrationRequest = CALIBRATE_NONE;
+	GLuint numCalibrationViews = 32;
+	GLuint numSaturatedViews[maxSlefeDivs + 1] = {}; // Views that miss pixelAccuracy even at the largest factor
+	int slefeEnclosure = ENCLOSURE_AXIS_BOX;
+	const char * const enclosureNames[NUM_ENCLOSURES] = {"Axis box", "Tangent box"};
+	GLuint estimatedTriangles[NUM_ENCLOSURES] = {};
+	PatchSlefeBoxes patchSlefeBoxes[maxModelPatches];
 	vector<vec3> slefeTileVertices;
 	vector<GLuint> slefeTileIndices;
-	GLuint patchSlefeTileIndices[NumTeapotPatches][2]; // first index, last index
+	GLuint patchSlefeTileIndices[maxModelPatches][2]; // first index, last index
+	GLuint slefeBoxTexture; // Texture buffer over BUFFER_SLEFE_BOXES, for TESS_IPASS_GPU
+	// Texture buffers iPASS.vert reads quantized control points through, see BindQuantizedControlPoints()
+	GLuint controlPointBoxTexture, sharedVertexTexture, sharedTessLevelTexture;
+	static const GLuint slefeBoxTexels = 4; // The center and the 3 half axes, as iPASS.tesc reads them
+	bool slefeBoxBufferChanged = true;
+	vector<vector<std::pair<GLint, GLint>>> patchEdgeSides; // (patch, edge) pairs sharing each edge
+	GLuint patchEdges[maxModelPatches][4]; // Edge IDs, in the order of the outer tess levels
+	// TESS_IPASS_PIPELINED: the render thread posts the current view and draws with the levels tessLevelThread
+	// computed for an earlier one, so that the CPU work overlaps with the rest of the frame
+	std::thread tessLevelThread;
+	std::atomic<bool> stopTessLevelThread{false};
+	std::mutex tessLevelWakeMutex; // Only for waiting on tessLevelWake; the buffers themselves are lock-free
+	std::condition_variable tessLevelWake;
+	TripleBuffer<TessLevelJob> tessLevelJobs;
+	TripleBuffer<TessLevelResult> tessLevelResults;
+	bool havePipelinedLevels = false;
+	bool cacheTessLevels = true; // Temporal reuse of TESS_IPASS levels
+	float levelHysteresis = 0.1; // Fraction a cached level has to be too high by before it's lowered
+	struct CachedTessLevel
+	{
+		float level; // As used, after hysteresis
+		float computedLevel;
+		float screenScale; // ProjectPatchBounds() when computedLevel was computed
+		bool inside;
+		GLuint slefeDivs; // With adaptiveSlefeDivs
+	} cachedTessLevels[maxModelPatches];
+	TessLevelJob cachedTessView;
+	GLuint cachedSlefeBoxesGeneration;
+	bool tessLevelCacheValid = false;
+	GLuint numRecomputedPatches = 0;
+	// TESS_IPASS can pick each patch's slefe divs from its projected size instead of using numSlefeDivs. The slefe
+	// and axis boxes of each patch are built the first time it needs them at a div count, and kept.
+	bool adaptiveSlefeDivs = false;
+	float slefeDivPixels = 64; // Projected size of the patch's control points per div
+	struct PatchSlefeCache
+	{
+		Slefe slefe;
+		vec3 pointBoxVertices[maxSlefeDivs + 1][maxSlefeDivs + 1][8];
+		vec3 tileBoxVertices[maxSlefeDivs][maxSlefeDivs][8];
+	};
+	unique_ptr<PatchSlefeCache> patchSlefeCaches[maxModelPatches][maxSlefeDivs + 1];
+	GLuint adaptiveDivsRange[2] = {}; // Fewest and most divs of a patch in the last frame
+	AABB patchBounds[maxModelPatches]; // Of the control points
+	GLuint slefeBoxesGeneration = 0; // Counts rebuilds of the slefe boxes
+	bool computeSupported; // TESS_COMPUTE needs GL 4.3
+	GLint patchVertexLimit; // GL_MAX_PATCH_VERTICES
+	unique_ptr<ShaderProgram> slefeComputeProgram, levelComputeProgram; // Built when TESS_COMPUTE is first used
+	GLuint computedSlefeDivs = 0; // numSlefeDivs of the slefes in BUFFER_SLEFE_POINTS
+	bool validateComputeRequest = false;
+	struct
+	{
+		float maxPointError;
+		float maxLevelError;
+		GLuint numVisibilityMismatches;
+		GLuint numVisiblePatches[2]; // CPU, GPU
+	} computeValidation = {};
 	bool showError = false;
+	enum {SHOW_ERROR_NONE, SHOW_ERROR_COLORED, SHOW_ERROR_RAW}; // SHOW_ERROR values
 
 	// Scene
 	vec3 backgroundColor = vec3(24 / 255.0f);
@@ -117,6 +302,7 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 	vec3 diffuseColor1 = vec3(0.5, 0, 0);
 	vec3 diffuseColor2 = vec3(0);
 	GLuint texture;
+	static const GLuint maxCheckerLevel = 10;
 	bool useTexture = true;
 	GLint textureRepeat = 5;
 	const GLenum minFilters[6] =
@@ -149,6 +335,57 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 	float shininess = 32;
 	int bezierPatchMethod = 3;
 
+	// Draw order
+	enum {DRAW_PATCH_RANGE, DRAW_PATCH_LIST, DRAW_INDIRECT};
+	bool sortPatches = false;
+	GLuint numPatchListIndices = 0;
+	bool depthPrepass = false; // Not conservative, see RenderDepthPrepass()
+	float slefeWidths[maxModelPatches]; // Largest distance between a patch's lower and upper slefe points
+	vector<GLint> patchList; // Patches of the DRAW_PATCH_LIST, in order
+	// With cacheTessellation, each patch's triangles are captured with transform feedback into its slot of
+	// BUFFER_CAPTURED_VERTICES, and replayed until its levels change
+	bool cacheTessellation = false;
+	struct CapturedPatch
+	{
+		float outer[4], inner[2]; // Levels of the capture
+		GLintptr offset; // Of the slot, in bytes
+		GLuint capacity; // Of the slot, in triangles
+		bool valid;
+	} capturedPatches[maxModelPatches] = {};
+	static const GLsizei capturedVertexSize = (threeD + threeD + 2) * sizeof(GLfloat); // Position, normal, tex coord
+	GLuint captureFeedbacks[maxModelPatches]; // Transform feedback objects, which keep the count of each capture
+	GLuint numCapturedPatches = 0; // In the last frame
+	GLuint numCaptureLayouts = 0; // Times the slots were laid out again for a patch that outgrew its slot
+	// GPU residency: with pageClusters, the patches in patchRange are grouped into spatial clusters, whose bounds stay
+	// resident, and the control points of the visible ones, with their slefe boxes in TESS_IPASS_GPU, are paged into
+	// a fixed pool of slots on the GPU, the largest on screen first. This bounds the model's GPU memory, not its CPU
+	// memory: the clusters are copied from the PatchModel, which is always in memory, rather than read from disk. The
+	// whole-model BUFFER_CONTROL_POINTS and BUFFER_SLEFE_BOXES are left empty, so TESS_COMPUTE and whatever else draws
+	// from them are off.
+	bool pageClusters = false;
+	static const GLuint poolSlotVertices = clusterPatches * maxPatchVertices; // Control points and indices
+	vector<PatchCluster> patchClusters;
+	GLuint numPoolSlots = 16;
+	vector<GLint> poolClusters; // Cluster in each slot, or -1
+	// Each slot's patches in the layout of UploadSlefeBoxes(), so that FirstPatch picks out a slot, followed by each
+	// slot's edges, with room for the cluster with the most sides along its edges
+	GLuint poolSlefeBoxTexture; // Texture buffer over BUFFER_POOL_SLEFE_BOXES
+	GLuint poolSlotEdgeTexels = 0;
+	bool poolSlefeBoxesValid = false; // For all of the resident clusters
+	GLuint maxClusterUploads = 4; // Per frame
+	GLuint poolFrame = 0;
+	struct {GLuint numVisible, numResident, numUploaded, numMissing;} poolStats = {}; // In the last frame
+	bool cullOccludedPatches = false; // Against the depth of an earlier frame, then re-tested against the current one
+	HiZView hiZView, pendingHiZView; // Of hiZPyramid, and of the read in flight
+	vector<HiZLevel> hiZPyramid; // Max depths, from half the framebuffer's resolution down to 1x1
+	GLuint hiZFramebuffer = 0, hiZRenderbuffer;
+	int hiZFramebufferSize[2] = {};
+	GLsync hiZReadFence = 0; // Of the glReadPixels() into BUFFER_DEPTH_READBACK
+	GLuint numOccludedPatches = 0;
+	vector<GLint> occludedPatches; // Culled by BuildPatchList(), and tested again against the current frame's depth
+	vector<bool> occlusionTested; // Of occludedPatches; the rest are drawn regardless
+	GLuint occlusionQueries[maxModelPatches]; // Of the boxes of occludedPatches
+
 	// Debug
 	bool showStatsCounters = false;
 	enum {QUERY_TRIANGLES, QUERY_FRAGMENTS, NUM_QUERIES};
@@ -166,76 +403,344 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 	vec3 slefeBoxColor = vec3(0.5, 1, 0.5);
 	bool showScreenRects = false;
 	vec3 slefeRectColor = vec3(0.5, 0.5, 1);
+	enum {REFERENCE_NONE, REFERENCE_VIEW, REFERENCE_SWEEP, REFERENCE_ENCLOSURES};
+	int referenceRequest = REFERENCE_NONE;
+	float referencePercentile = 99;
+	GLuint numReferenceViews = 1000;
+	TessError referencePatchErrors[maxModelPatches] = {};
+	TessError referenceError = {}; // Totals for the view or sweep; the percentile is that of the worst patch
+	TessError enclosureErrors[NUM_ENCLOSURES] = {}; // Of the view, with the levels from each enclosure
+
+	// The Bezier patches the shaders evaluate; B-spline spans are converted to bicubic ones in iPASS.tesc
+	static string
+	GetDegreePreprocessor(const PatchModel &patches)
+	{
+		string preproc = std::string("#define DEGREE_U ") + std::to_string(patches.degree[0]) + '\n';
 
-	void
-	RebuildMainProgram()
+		preproc+= string("#define DEGREE_V ") + std::to_string(patches.degree[1]) + '\n';
+		preproc+= string("#define PATCH_VERTICES ") + std::to_string(patches.GetNumPatchVertices()) + '\n';
+
+		return preproc;
+	}
+
+	static string
+	GetGeometryPreprocessor(int method, bool error, bool fracTess, bool gpuLevels, const PatchModel &patches,
+			bool depthPrepass = false, bool capture = false)
 	{
-		string preproc = std::string("#define METHOD ") + std::to_string(bezierPatchMethod) + '\n';
+		string preproc = std::string("#define METHOD ") + std::to_string(method) + '\n';
 
-		preproc+= string("#define SHOW_ERROR ") + std::to_string(showError) + '\n';
-		preproc+= string("#define SHOW_NORMAL ") + std::to_string(showNormals) + '\n';
+		preproc+= string("#define SHOW_ERROR ") + std::to_string(error) + '\n';
+		preproc+= string("#define GPU_TESS_LEVELS ") + std::to_string(gpuLevels) + '\n';
+		preproc+= string("#define BSPLINE ") + std::to_string(patches.bSpline) + '\n';
+		preproc+= string("#define DEPTH_PREPASS ") + std::to_string(depthPrepass) + '\n';
+		preproc+= string("#define CAPTURE ") + std::to_string(capture) + '\n';
+		preproc+= GetDegreePreprocessor(patches);
 
-		if (fracTessLevels)
+		if (fracTess)
 			preproc+= "#define TESS_SPACING fractional_even_spacing\n";
 		else
 			preproc+= "#define TESS_SPACING equal_spacing\n";
 
-		mainProgram = nullptr;
-		mainProgram = unique_ptr<ShaderProgram>(new ShaderProgram("#version 410 core\n", preproc.c_str()));
+		return preproc;
+	}
+
+	static string
+	GetFragmentPreprocessor(int method, int error, bool normals, const PatchModel &patches)
+	{
+		string preproc = std::string("#define METHOD ") + std::to_string(method) + '\n';
 
-		mainProgram->LoadShader(GL_VERTEX_SHADER, "iPASS.vert");
+		preproc+= string("#define SHOW_ERROR ") + std::to_string(error) + '\n';
+		preproc+= string("#define SHOW_NORMAL ") + std::to_string(normals) + '\n';
+		preproc+= GetDegreePreprocessor(patches);
 
-		mainProgram->Include("BicubicBezier.glsl");
+		return preproc;
+	}
 
-		mainProgram->LoadShader(GL_TESS_CONTROL_SHADER, "iPASS.tesc");
-		mainProgram->LoadShader(GL_TESS_EVALUATION_SHADER, "iPASS.tese");
-		if (showError || showNormals)
-			mainProgram->LoadShader(GL_FRAGMENT_SHADER, "Debug.frag");
+	// $XDG_CACHE_HOME/PixAccCurvedSurf, or ~/.cache/PixAccCurvedSurf; empty, so the binaries aren't cached, if it can't
+	// be created
+	static string
+	CreateShaderCacheDir()
+	{
+		string cacheHome;
+		if (getenv("XDG_CACHE_HOME") && *getenv("XDG_CACHE_HOME"))
+			cacheHome = getenv("XDG_CACHE_HOME");
+		else if (getenv("HOME"))
+			cacheHome = string(getenv("HOME")) + "/.cache";
 		else
-			mainProgram->LoadShader(GL_FRAGMENT_SHADER, "BlinnPhong.frag");
+		{
+			clog << "Neither XDG_CACHE_HOME nor HOME is set; shader binaries won't be cached" << endl;
+			return string();
+		}
+
+		string dir = cacheHome + '/' + shaderCacheName;
+		for (const string &path : {cacheHome, dir})
+			if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST)
+			{
+				clog << "Can't create " << path << ": " << strerror(errno) << "; shader binaries won't be cached"
+				     << endl;
+				return string();
+			}
 
-		mainProgram->Link();
+		return dir;
 	}
 
-	void
-	UpdateTexture()
+	// With capture, iPASS.tese's outputs are recorded for Replay.vert's attributes
+	unique_ptr<ShaderProgram>
+	BuildGeometryProgram(const string &preproc, bool capture = false)
 	{
-		glBindTexture(GL_TEXTURE_2D, texture);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilters[minFilterIndex]);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilters[magFilterIndex]);
+		unique_ptr<ShaderProgram> program(new ShaderProgram("#version 410 core\n", preproc.c_str()));
+		program->SetBinaryCache(shaderCacheDir);
+		program->SetSeparable();
+		if (capture)
+			program->SetTransformFeedbackVaryings({"WorldPosition", "Normal", "TexCoord"});
+
+		program->Include("Uniforms.glsl");
+
+		program->LoadShader(GL_VERTEX_SHADER, "iPASS.vert");
+
+		program->Include("BicubicBezier.glsl");
 
-		if (useTexture)
+		program->LoadShader(GL_TESS_CONTROL_SHADER, "iPASS.tesc");
+		program->LoadShader(GL_TESS_EVALUATION_SHADER, "iPASS.tese");
+
+		program->Link();
+
+		program->BindUniformBlock("FrameUniforms", UNIFORM_BLOCK_FRAME);
+		program->BindUniformBlock("MaterialUniforms", UNIFORM_BLOCK_MATERIAL);
+		program->BindUniformBlock("TessUniforms", UNIFORM_BLOCK_TESS);
+
+		static const struct {const char *name; GLint unit;} samplers[] =
+		{
+			{"SlefeBoxes", TEXTURE_UNIT_SLEFE_BOXES},
+			{"ControlPointBoxes", TEXTURE_UNIT_CONTROL_POINT_BOXES},
+			{"SharedVertices", TEXTURE_UNIT_SHARED_VERTICES},
+			{"SharedTessLevels", TEXTURE_UNIT_SHARED_TESS_LEVELS}
+		};
+		for (auto &sampler : samplers)
 		{
-			static const GLuint minCheckerSize = 2;
-			static const GLuint maxCheckerLevel = 10;
+			GLint location = program->GetUniformLocation(sampler.name, false);
+			if (location != -1)
+				program->SetUniform(location, sampler.unit);
+		}
 
-			for (GLuint checkerLevel = 0; checkerLevel <= maxCheckerLevel; ++checkerLevel)
-			{
-				GLuint checkerSize = minCheckerSize << (maxCheckerLevel - checkerLevel);
+		return program;
+	}
 
-				static vec3 checker[(minCheckerSize << maxCheckerLevel) * (minCheckerSize << maxCheckerLevel)];
-				for (GLuint u = 0; u < checkerSize; ++u)
-					for (GLuint v = 0; v < checkerSize; ++v)
-					{
-						bool check = ((u < checkerSize / 2) ^ (v < checkerSize / 2));
-						checker[v * checkerSize + u] = (check) ? diffuseColor1 : diffuseColor2;
-					}
+	unique_ptr<ShaderProgram>
+	BuildFragmentProgram(const string &preproc, bool debugFrag)
+	{
+		unique_ptr<ShaderProgram> program(new ShaderProgram("#version 410 core\n", preproc.c_str()));
+		program->SetBinaryCache(shaderCacheDir);
+		program->SetSeparable();
 
-				glTexImage2D(GL_TEXTURE_2D, checkerLevel, GL_RGB, checkerSize, checkerSize, 0, GL_RGB, GL_FLOAT, checker);
-			}
+		program->Include("Uniforms.glsl");
 
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxCheckerLevel);
-			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, minTextureLOD);
-			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_LOD, maxTextureLOD);
+		if (debugFrag)
+		{
+			program->Include("BicubicBezier.glsl");
+			program->LoadShader(GL_FRAGMENT_SHADER, "Debug.frag");
 		}
 		else
+			program->LoadShader(GL_FRAGMENT_SHADER, "BlinnPhong.frag");
+
+		program->Link();
+
+		program->BindUniformBlock("FrameUniforms", UNIFORM_BLOCK_FRAME);
+		program->BindUniformBlock("MaterialUniforms", UNIFORM_BLOCK_MATERIAL);
+
+		return program;
+	}
+
+	unique_ptr<ShaderProgram>
+	BuildComputeProgram(const char *path)
+	{
+		string preproc = string("#define MAX_SLEFE_DIVS ") + std::to_string(maxSlefeDivs) + '\n';
+		preproc+= string("#define BSPLINE ") + std::to_string(model->bSpline) + '\n';
+		preproc+= string("#define QUANTIZED ") + std::to_string(quantizeControlPoints) + '\n';
+		preproc+= GetDegreePreprocessor(*model);
+
+		unique_ptr<ShaderProgram> program(new ShaderProgram("#version 430 core\n", preproc.c_str()));
+		program->SetBinaryCache(shaderCacheDir);
+
+		program->Include("Uniforms.glsl");
+		program->Include("SlefeBuffers.glsl");
+
+		program->LoadShader(GL_COMPUTE_SHADER, path);
+
+		program->Link();
+
+		program->BindUniformBlock("FrameUniforms", UNIFORM_BLOCK_FRAME);
+		program->BindUniformBlock("TessUniforms", UNIFORM_BLOCK_TESS);
+
+		return program;
+	}
+
+	// Keys are the source file names followed by the preprocessor string
+	static string
+	GetGeometryKey(int method, bool error, bool fracTess, bool gpuLevels, const PatchModel &patches,
+			bool depthPrepass = false, bool capture = false)
+	{
+		return "iPASS\n" + GetGeometryPreprocessor(method, error, fracTess, gpuLevels, patches, depthPrepass, capture);
+	}
+
+	static string
+	GetFragmentKey(int method, int error, bool normals, const PatchModel &patches)
+	{
+		if (error || normals)
+			return "Debug.frag\n" + GetFragmentPreprocessor(method, error, normals, patches);
+		else
+			return "BlinnPhong.frag\n";
+	}
+
+	unique_ptr<ShaderProgram>
+	BuildStageProgram(int method, int error, bool normals, bool fracTess, bool gpuLevels, const PatchModel &patches,
+			bool geometry, bool depthPrepass = false, bool capture = false)
+	{
+		if (geometry)
+			return BuildGeometryProgram(GetGeometryPreprocessor(method, error, fracTess, gpuLevels, patches,
+			                                                    depthPrepass, capture), capture);
+		else
+			return BuildFragmentProgram(GetFragmentPreprocessor(method, error, normals, patches), error || normals);
+	}
+
+	ShaderProgram *
+	GetStageProgram(int method, int error, bool normals, bool fracTess, bool gpuLevels, const PatchModel &patches,
+			bool geometry, bool depthPrepass = false, bool capture = false)
+	{
+		string key = (geometry) ? GetGeometryKey(method, error, fracTess, gpuLevels, patches, depthPrepass, capture) :
+		                          GetFragmentKey(method, error, normals, patches);
+
+		{
+			std::lock_guard<std::mutex> lock(stageProgramsMutex);
+			auto it = stagePrograms.find(key);
+			if (it != stagePrograms.end())
+				return it->second.get();
+		}
+
+		// Not precompiled yet, so build it here rather than waiting for the worker to get to it
+		unique_ptr<ShaderProgram> program = BuildStageProgram(method, error, normals, fracTess, gpuLevels, patches,
+		                                                      geometry, depthPrepass, capture);
+
+		std::lock_guard<std::mutex> lock(stageProgramsMutex);
+		unique_ptr<ShaderProgram> &slot = stagePrograms[key];
+		if (!slot)
+			slot = std::move(program);
+		return slot.get();
+	}
+
+	void
+	RebuildMainProgram()
+	{
+		bool gpuLevels = (tessMode == TESS_IPASS_GPU);
+		geometryProgram = GetStageProgram(bezierPatchMethod, showError, showNormals, fracTessLevels, gpuLevels,
+		                                  *model, true);
+		fragmentProgram = GetStageProgram(bezierPatchMethod, showError, showNormals, fracTessLevels, gpuLevels,
+		                                  *model, false);
+
+		mainPipeline.UseStages(*geometryProgram);
+		mainPipeline.UseStages(*fragmentProgram);
+
+		// Depth only, so without a fragment stage
+		if (depthPrepass)
+			depthPrepassPipeline.UseStages(*GetStageProgram(bezierPatchMethod, SHOW_ERROR_NONE, false, false, false,
+			                                                *model, true, true));
+
+		// Captures only ever use CPU levels, and are rasterized by the replay pipeline instead
+		if (cacheTessellation)
+		{
+			capturePipeline.UseStages(*GetStageProgram(bezierPatchMethod, SHOW_ERROR_NONE, false, fracTessLevels, false,
+			                                           *model, true, false, true));
+			replayPipeline.UseStages(*fragmentProgram);
+		}
+
+		// The captures depend on every setting these programs do
+		for (auto &patch : capturedPatches)
+			patch.valid = false;
+	}
+
+	// Runs on precompileThread, building the stage programs the shading and tessellation checkboxes can switch to for
+	// the model and method at startup. Other models and methods are built on demand by GetStageProgram().
+	void
+	PrecompileMainPrograms(const PatchModel *model, int method)
+	{
+		glfwMakeContextCurrent(precompileContext.get());
+
+		try
 		{
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_FLOAT, &diffuseColor1);
+			static const GLuint numPermutations = 2 * 2 * 2 * 2;
+			const PatchModel &patches = *model;
+			for (GLuint i = 0; i < numPermutations * 2 && !stopPrecompile; ++i)
+			{
+				bool geometry = (i < numPermutations);
+				GLuint permutation = i % numPermutations;
+				bool error = (permutation & 8), normals = (permutation & 4), fracTess = (permutation & 2);
+				bool gpuLevels = (permutation & 1);
+				string key = (geometry) ? GetGeometryKey(method, error, fracTess, gpuLevels, patches) :
+				                          GetFragmentKey(method, error, normals, patches);
+
+				{
+					std::lock_guard<std::mutex> lock(stageProgramsMutex);
+					if (stagePrograms.count(key))
+						continue;
+				}
+
+				unique_ptr<ShaderProgram> program = BuildStageProgram(method, error, normals, fracTess, gpuLevels, patches,
+				                                                      geometry);
 
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+				// The main context can only use the program once linking has actually completed
+				glFinish();
+
+				std::lock_guard<std::mutex> lock(stageProgramsMutex);
+				unique_ptr<ShaderProgram> &slot = stagePrograms[key];
+				if (!slot)
+					slot = std::move(program);
+			}
 		}
+		catch (std::runtime_error &error)
+		{
+			clog << "Error while precompiling shader permutations: " << error.what() << endl;
+		}
+
+		glfwMakeContextCurrent(NULL);
+	}
+
+	// The checker is stored as a single-channel mask that BlinnPhong.frag uses to mix the two diffuse colors, so
+	// color edits don't touch the texture at all.
+	void
+	CreateCheckerTexture()
+	{
+		static const GLuint minCheckerSize = 2;
+
+		GLuint checkerSize = minCheckerSize << maxCheckerLevel;
+		vector<GLubyte> checker(checkerSize * checkerSize);
+		for (GLuint u = 0; u < checkerSize; ++u)
+			for (GLuint v = 0; v < checkerSize; ++v)
+			{
+				bool check = ((u < checkerSize / 2) ^ (v < checkerSize / 2));
+				checker[v * checkerSize + u] = (check) ? 255 : 0;
+			}
+
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, checkerSize, checkerSize, 0, GL_RED, GL_UNSIGNED_BYTE, checker.data());
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		// Box filtering a 2x2 checker keeps it a crisp 2x2 checker all the way down to the 2x2 level
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxCheckerLevel);
+		glGenerateMipmap(GL_TEXTURE_2D);
+
+		CheckGLErrors("CreateCheckerTexture()");
+	}
+
+	void
+	UpdateTexture()
+	{
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilters[minFilterIndex]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilters[magFilterIndex]);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_LOD, minTextureLOD);
+		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_LOD, maxTextureLOD);
 
 		CheckGLErrors("UpdateTexture()");
 	}
@@ -246,6 +751,58 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		program.SetCamera(modelViewMatrix, projectionMatrix);
 	}
 
+	// With BUFFER_CONTROL_POINTS bound to GL_ARRAY_BUFFER. Quantized values come in as they are, for iPASS.vert to
+	// decode.
+	void
+	SetControlPointPointer(GLuint location)
+	{
+		if (quantizeControlPoints)
+			glVertexAttribPointer(location, threeD, GL_UNSIGNED_SHORT, GL_FALSE, 0, 0);
+		else
+			glVertexAttribPointer(location, threeD, GL_FLOAT, GL_FALSE, 0, 0);
+	}
+
+	// Control point i of a patch as the GPU decodes it from BUFFER_CONTROL_POINTS
+	vec3
+	GetControlPoint(GLint patchIndex, GLuint i) const
+	{
+		const float *vertex = model->vertices[model->GetPatchIndices(patchIndex)[i]];
+		if (!quantizeControlPoints)
+			return vec3(vertex[0], vertex[1], vertex[2]);
+
+		const GLushort *value = &quantizedVertices[(patchIndex * model->GetNumPatchVertices() + i) * threeD];
+		const ControlPointBox &box = controlPointBoxes[patchIndex];
+		return box.origin + box.step * vec3(value[0], value[1], value[2]);
+	}
+
+	void
+	GetPatchControlPoints(GLint patchIndex, vec3 controlPoints[maxPatchVertices]) const
+	{
+		for (GLuint i = 0; i < model->GetNumPatchVertices(); ++i)
+			controlPoints[i] = GetControlPoint(patchIndex, i);
+	}
+
+	// Furthest GetControlPoint() is off the model's control point in each axis
+	vec3
+	GetControlPointError(GLint patchIndex) const
+	{
+		return (quantizeControlPoints) ? controlPointBoxes[patchIndex].error : vec3(0);
+	}
+
+	// BUFFER_DEBUG_VERTICES gets the control points as the GPU decodes them, by model vertex. Shared ones decode the
+	// same in each of their patches, see QuantizeControlPoints().
+	void
+	UploadDebugControlPoints()
+	{
+		vector<vec3> vertices(model->numVertices);
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			for (GLuint i = 0; i < model->GetNumPatchVertices(); ++i)
+				vertices[model->GetPatchIndices(patchIndex)[i]] = GetControlPoint(patchIndex, i);
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_DEBUG_VERTICES]);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(vertices[0]), vertices.data(), GL_STREAM_DRAW);
+	}
+
 	void
 	RenderDebugPrimitives(GLenum type,
 			const vec3 &color,
@@ -262,7 +819,7 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		glEnableVertexAttribArray(positionLocation);
 		glVertexAttribPointer(positionLocation, threeD, GL_FLOAT, GL_FALSE, 0, 0);
 
-		debugProgram.SetUniform("Color", color);
+		debugProgram.SetUniform(debugColorLocation, color);
 
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_DEBUG_INDICES]);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STREAM_DRAW);
@@ -310,19 +867,19 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 			if (patchesOpen)
 				patchOpen = ImGui::TreeNode((string("Patch ") + std::to_string(i)).c_str());
 
-			for (GLuint j = 0; j < numCubicTerms; ++j)
-				for (GLuint k = 0; k < numCubicTerms; ++k)
+			for (GLuint j = 0; j <= model->degree[0]; ++j)
+				for (GLuint k = 0; k <= model->degree[1]; ++k)
 				{
 					if (patchOpen)
 					{
-						const float (&vertex)[threeD] = TeapotVertices[TeapotIndices[i][j][k]];
+						const float (&vertex)[threeD] = model->vertices[model->GetIndex(i, j, k)];
 						ImGui::Text("[%u][%u] = %f %f %f", j, k, vertex[0], vertex[1], vertex[2]);
 					}
 
-					if ((j == 0 || j == 3) && (k == 0 || k == 3))
-						anchorIndices.push_back(TeapotIndices[i][j][k]);
+					if ((j == 0 || j == model->degree[0]) && (k == 0 || k == model->degree[1]))
+						anchorIndices.push_back(model->GetIndex(i, j, k));
 					else
-						controlIndices.push_back(TeapotIndices[i][j][k]);
+						controlIndices.push_back(model->GetIndex(i, j, k));
 				}
 
 			if (patchOpen)
@@ -336,7 +893,7 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 
         glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_DEBUG]);
 
-        glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINTS]);
+		UploadDebugControlPoints();
 
 		Set3DCamera(debugProgram);
 
@@ -357,21 +914,26 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		vector<GLuint> indices;
 
 		for (GLint i = patchRange[0]; i < patchRange[0] + patchRange[1]; ++i)
-			for (GLuint j = 0; j < numCubicTerms; ++j)
-				for (GLuint k = 0; k < numCubicTerms; ++k)
-					if (k < 3)
+			for (GLuint j = 0; j <= model->degree[0]; ++j)
+				for (GLuint k = 0; k <= model->degree[1]; ++k)
+				{
+					if (k < model->degree[1])
+					{
+						indices.push_back(model->GetIndex(i, j, k));
+						indices.push_back(model->GetIndex(i, j, k + 1));
+					}
+					if (j < model->degree[0])
 					{
-						indices.push_back(TeapotIndices[i][j][k]);
-						indices.push_back(TeapotIndices[i][j][k + 1]);
-						indices.push_back(TeapotIndices[i][k][j]);
-						indices.push_back(TeapotIndices[i][k + 1][j]);
+						indices.push_back(model->GetIndex(i, j, k));
+						indices.push_back(model->GetIndex(i, j + 1, k));
 					}
+				}
 
 		debugProgram.Use();
 
         glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_DEBUG]);
 
-        glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINTS]);
+		UploadDebugControlPoints();
 
 		Set3DCamera(debugProgram);
 
@@ -381,19 +943,119 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		RenderDebugPrimitives(GL_LINES, controlMeshColor, indices);
 	}
 
+	// Slefe of one patch at divs pieces per side, of the control points as the GPU decodes them, which
+	// ComputeSlefe() widens by how far those are off the model's
+	float
+	ComputePatchSlefe(GLint patchIndex, GLuint divs, Slefe &slefe, bool singlePrecision)
+	{
+		vec3 controlPoints[maxPatchVertices];
+		GetPatchControlPoints(patchIndex, controlPoints);
+
+		return ComputeSlefe(*model, controlPoints, GetControlPointError(patchIndex), divs, singlePrecision, slefe);
+	}
+
+	// Times SubLiME's tpSlefe() against the kernels in SlefeKernels.hh, fused and unfused in double and fused in float,
+	// on every patch at numSlefeDivs
 	void
-	ComputeSlefeMidPoints(Slefe &slefe)
+	BenchmarkSlefeKernels()
 	{
-		for (GLuint whichBounds = 0; whichBounds < Slefe::NUM_BOUNDS; ++whichBounds)
-		{
-			auto &points = slefe.bounds[whichBounds].points;
-			for (GLuint u = 0; u < numSlefeDivs; ++u)
-				for (GLuint v = 0; v < numSlefeDivs; ++v)
+		static const GLuint numRepeats = 1000;
+		static const GLuint numCoeffs = maxPatchVertices * threeD;
+		static const GLuint numPoints = (maxSlefeDivs + 1) * (maxSlefeDivs + 1) * threeD;
+
+		vector<array<REAL, numCoeffs>> coeffs(model->numPatches);
+		vector<array<float, numCoeffs>> floatCoeffs(model->numPatches);
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			for (GLuint i = 0; i < model->GetNumPatchVertices(); ++i)
+				for (GLuint dim = 0; dim < threeD; ++dim)
 				{
-					slefe.midPoints[u][v][whichBounds][0] = glm::mix(points[u][v], points[u + 1][v + 1], 0.5);
-					slefe.midPoints[u][v][whichBounds][1] = glm::mix(points[u + 1][v], points[u][v + 1], 0.5);
+					floatCoeffs[patchIndex][i * threeD + dim] =
+							model->vertices[model->GetPatchIndices(patchIndex)[i]][dim];
+					coeffs[patchIndex][i * threeD + dim] = floatCoeffs[patchIndex][i * threeD + dim];
 				}
-		}
+
+		vector<array<REAL, numPoints>> libraryUpper(model->numPatches), libraryLower(model->numPatches);
+		vector<array<REAL, numPoints>> kernelUpper(model->numPatches), kernelLower(model->numPatches);
+		vector<array<REAL, numPoints>> unfusedUpper(model->numPatches), unfusedLower(model->numPatches);
+		vector<array<float, numPoints>> floatUpper(model->numPatches), floatLower(model->numPatches);
+		int degreeU = model->degree[0], degreeV = model->degree[1];
+		int strideU = (degreeV + 1) * threeD, strideV = threeD;
+		int slefeStrideU = (maxSlefeDivs + 1) * threeD, slefeStrideV = threeD;
+
+		auto start = std::chrono::steady_clock::now();
+		for (GLuint repeat = 0; repeat < numRepeats; ++repeat)
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+				for (GLuint dim = 0; dim < threeD; ++dim)
+					tpSlefe(coeffs[patchIndex].data() + dim, strideU, strideV, degreeU, degreeV,
+					        numSlefeDivs, numSlefeDivs,
+					        libraryUpper[patchIndex].data() + dim, libraryLower[patchIndex].data() + dim,
+					        slefeStrideU, slefeStrideV);
+
+		auto kernelStart = std::chrono::steady_clock::now();
+		for (GLuint repeat = 0; repeat < numRepeats; ++repeat)
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+				for (GLuint dim = 0; dim < threeD; ++dim)
+					BezierTensorSlefeDegreeDispatch<>::Run(degreeU, degreeV, numSlefeDivs,
+					                                       coeffs[patchIndex].data() + dim, strideU, strideV,
+					                                       kernelUpper[patchIndex].data() + dim,
+					                                       kernelLower[patchIndex].data() + dim,
+					                                       slefeStrideU, slefeStrideV);
+
+		auto unfusedStart = std::chrono::steady_clock::now();
+		for (GLuint repeat = 0; repeat < numRepeats; ++repeat)
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+				for (GLuint dim = 0; dim < threeD; ++dim)
+					BezierTensorSlefeDegreeDispatch<>::Run<false>(degreeU, degreeV, numSlefeDivs,
+					                                              coeffs[patchIndex].data() + dim, strideU, strideV,
+					                                              unfusedUpper[patchIndex].data() + dim,
+					                                              unfusedLower[patchIndex].data() + dim,
+					                                              slefeStrideU, slefeStrideV);
+
+		auto floatStart = std::chrono::steady_clock::now();
+		for (GLuint repeat = 0; repeat < numRepeats; ++repeat)
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+				for (GLuint dim = 0; dim < threeD; ++dim)
+					BezierTensorSlefeInflated(degreeU, degreeV, numSlefeDivs, floatCoeffs[patchIndex].data() + dim,
+					                          strideU, strideV, floatUpper[patchIndex].data() + dim,
+					                          floatLower[patchIndex].data() + dim, slefeStrideU, slefeStrideV);
+		auto end = std::chrono::steady_clock::now();
+
+		double numSlefes = numRepeats * model->numPatches;
+		slefeBenchmark.divs = numSlefeDivs;
+		slefeBenchmark.libraryMicroseconds =
+				std::chrono::duration<double, std::micro>(kernelStart - start).count() / numSlefes;
+		slefeBenchmark.kernelMicroseconds =
+				std::chrono::duration<double, std::micro>(unfusedStart - kernelStart).count() / numSlefes;
+		slefeBenchmark.unfusedMicroseconds =
+				std::chrono::duration<double, std::micro>(floatStart - unfusedStart).count() / numSlefes;
+		slefeBenchmark.floatMicroseconds =
+				std::chrono::duration<double, std::micro>(end - floatStart).count() / numSlefes;
+
+		slefeBenchmark.maxDifference = 0;
+		slefeBenchmark.minFloatMargin = INFINITY;
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			for (GLuint u = 0; u <= numSlefeDivs; ++u)
+				for (GLuint v = 0; v <= numSlefeDivs; ++v)
+					for (GLuint dim = 0; dim < threeD; ++dim)
+					{
+						GLuint i = u * slefeStrideU + v * slefeStrideV + dim;
+						double upperDifference = libraryUpper[patchIndex][i] - kernelUpper[patchIndex][i];
+						double lowerDifference = libraryLower[patchIndex][i] - kernelLower[patchIndex][i];
+						double unfusedUpperDifference = libraryUpper[patchIndex][i] - unfusedUpper[patchIndex][i];
+						double unfusedLowerDifference = libraryLower[patchIndex][i] - unfusedLower[patchIndex][i];
+
+						slefeBenchmark.maxDifference = std::max({slefeBenchmark.maxDifference,
+						                                         std::abs(upperDifference), std::abs(lowerDifference),
+						                                         std::abs(unfusedUpperDifference),
+						                                         std::abs(unfusedLowerDifference)});
+
+						// How far outside the double bounds the float ones are, which should never be negative
+						double upperMargin = floatUpper[patchIndex][i] - libraryUpper[patchIndex][i];
+						double lowerMargin = libraryLower[patchIndex][i] - floatLower[patchIndex][i];
+
+						slefeBenchmark.minFloatMargin = std::min({slefeBenchmark.minFloatMargin,
+						                                          upperMargin, lowerMargin});
+					}
 	}
 
 	void
@@ -402,188 +1064,450 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		if (!slefesChanged)
 			return;
 
-		for (GLint patchIndex = 0; patchIndex < NumTeapotPatches; ++patchIndex)
-		{
-			REAL coeff[numCubicTerms][numCubicTerms][threeD];
-			for (GLuint u = 0; u < numCubicTerms; ++u)
-				for (GLuint v = 0; v < numCubicTerms; ++v)
-				{
-					const float *vertex = TeapotVertices[TeapotIndices[patchIndex][u][v]];
-					for (GLuint dim = 0; dim < threeD; ++dim)
-						coeff[u][v][dim] = vertex[dim];
-				}
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			slefeWidths[patchIndex] = ComputePatchSlefe(patchIndex, numSlefeDivs, slefes[patchIndex],
+			                                            singlePrecisionSlefes);
+
+		slefesChanged = false;
+		slefeBoxesChanged = true;
+	}
 
-			REAL lower[numSlefeDivs + 1][numSlefeDivs + 1][threeD];
-			REAL upper[numSlefeDivs + 1][numSlefeDivs + 1][threeD];
+	// ComputeSlefeTessLevel(), listing the tiles' screen edges in the debug window when the patch's node is open
+	float
+	ComputePatchTessLevel(const SlefeBox (&pointBoxes)[maxSlefeDivs + 1][maxSlefeDivs + 1],
+			const SlefeBox (&tileBoxes)[maxSlefeDivs][maxSlefeDivs], GLuint divs,
+			int screenWidth, int screenHeight, float mysteryFactor, bool patchOpen)
+	{
+		float tileMaxScreenEdges[maxSlefeDivs][maxSlefeDivs];
+		float level = ComputeSlefeTessLevel(pointBoxes, tileBoxes, divs, screenWidth, screenHeight, pixelAccuracy,
+		                                    mysteryFactor, (patchOpen) ? tileMaxScreenEdges : nullptr);
 
-			for (GLuint dim = 0; dim < threeD; ++dim)
-				tpSlefe(coeff[0][0] + dim, sizeof(coeff[0]) / sizeof(REAL), sizeof(coeff[0][0]) / sizeof(REAL),
-						3, 3, numSlefeDivs, numSlefeDivs,
-						lower[0][0] + dim, upper[0][0] + dim,
-						sizeof(lower[0]) / sizeof(REAL), sizeof(lower[0][0]) / sizeof(REAL));
+		if (patchOpen)
+			for (GLuint u = 0; u < divs; ++u)
+				for (GLuint v = 0; v < divs; ++v)
+					if (tileMaxScreenEdges[u][v] >= 0)
+						ImGui::Text("Tile[%u][%u] maxScreenEdge = %.2f", u, v, tileMaxScreenEdges[u][v]);
 
-			struct Slefe &slefe = slefes[patchIndex];
-			for (GLuint u = 0; u <= numSlefeDivs; ++u)
-				for (GLuint v = 0; v <= numSlefeDivs; ++v)
-				{
-					slefe.bounds[Slefe::LOWER].points[u][v] = vec3(lower[u][v][0], lower[u][v][1], lower[u][v][2]);
-					slefe.bounds[Slefe::UPPER].points[u][v] = vec3(upper[u][v][0], upper[u][v][1], upper[u][v][2]);
-				}
+		return level;
+	}
 
-			ComputeSlefeMidPoints(slefe);
-		}
+	float
+	ComputePatchTessLevel(GLint patchIndex, int screenWidth, int screenHeight, bool patchOpen)
+	{
+		return ComputePatchTessLevel(patchSlefeBoxes[patchIndex].pointBoxes, patchSlefeBoxes[patchIndex].tileBoxes,
+		                             numSlefeDivs, screenWidth, screenHeight, mysteryFactors[numSlefeDivs], patchOpen);
+	}
 
-		slefesChanged = false;
-		slefeBoxesChanged = true;
+	// Longest edge of the screen rect of the patch's control points, which bound the surface, and whether that rect is
+	// inside the view volume, in which case none of the patch's tiles can be culled
+	float
+	ProjectPatchBounds(GLint patchIndex, const mat4 &modelViewProjection, const vec3 &halfWindowSize, bool &inside,
+			AABB *screenRect = nullptr)
+	{
+		vec3 vertices[8];
+		GetAABBVertices(patchBounds[patchIndex], vertices);
+
+		SlefeBox box;
+		ComputeSlefeRect(box, vertices, 8, modelViewProjection, halfWindowSize);
+
+		inside = true;
+		for (GLuint dim = 0; dim < threeD; ++dim)
+			inside&= (box.screenAxisBox.min[dim] >= 0 && box.screenAxisBox.max[dim] <= 2 * halfWindowSize[dim]);
+
+		if (screenRect)
+			*screenRect = box.screenAxisBox;
+
+		return box.maxScreenEdge;
+	}
+
+	GLuint
+	SelectSlefeDivs(float screenScale)
+	{
+		if (!(screenScale < maxSlefeDivs * slefeDivPixels))
+			return maxSlefeDivs;
+
+		return glm::clamp(GLuint(ceilf(screenScale / slefeDivPixels)), 2u, maxSlefeDivs);
+	}
+
+	const PatchSlefeCache &
+	GetPatchSlefeCache(GLint patchIndex, GLuint divs)
+	{
+		unique_ptr<PatchSlefeCache> &cache = patchSlefeCaches[patchIndex][divs];
+		if (cache)
+			return *cache;
+
+		cache.reset(new PatchSlefeCache);
+		ComputePatchSlefe(patchIndex, divs, cache->slefe, singlePrecisionSlefes);
+
+		for (GLuint u = 0; u <= divs; ++u)
+			for (GLuint v = 0; v <= divs; ++v)
+			{
+				GetAABBVertices(GetPointAxisBox(cache->slefe, u, v), cache->pointBoxVertices[u][v]);
+				if (u < divs && v < divs)
+					GetAABBVertices(GetTileAxisBox(cache->slefe, u, v), cache->tileBoxVertices[u][v]);
+			}
+
+		return *cache;
+	}
+
+	// Level from the patch's axis boxes at divs, with the mystery factor calibrated for divs
+	float
+	ComputeAdaptivePatchTessLevel(GLint patchIndex, GLuint divs, const TessLevelJob &view, bool patchOpen)
+	{
+		const PatchSlefeCache &cache = GetPatchSlefeCache(patchIndex, divs);
+		vec3 halfWindowSize = vec3(view.screenWidth / 2.0, view.screenHeight / 2.0, 0.5);
+
+		SlefeBox pointBoxes[maxSlefeDivs + 1][maxSlefeDivs + 1];
+		SlefeBox tileBoxes[maxSlefeDivs][maxSlefeDivs];
+		for (GLuint u = 0; u <= divs; ++u)
+			for (GLuint v = 0; v <= divs; ++v)
+			{
+				ComputeSlefeRect(pointBoxes[u][v], cache.pointBoxVertices[u][v], 8, view.modelViewProjection,
+				                 halfWindowSize);
+				if (u < divs && v < divs)
+					ComputeSlefeRect(tileBoxes[u][v], cache.tileBoxVertices[u][v], 8, view.modelViewProjection,
+					                 halfWindowSize);
+			}
+
+		return ComputePatchTessLevel(pointBoxes, tileBoxes, divs, view.screenWidth, view.screenHeight,
+		                             mysteryFactors[divs], patchOpen);
 	}
 
+	// With cacheTessLevels, nothing is recomputed for an unchanged view, and after a camera move only the patches
+	// whose predicted level crosses a tess segment count or drops out of the hysteresis band are
 	void
-	ComputeTessLevels(float vertexTessLevels[NumTeapotVertices])
+	ComputeTessLevels(float vertexTessLevels[maxModelVertices])
 	{
-		ComputeSlefeRects();
+		ComputeSlefeBoxes();
+
+		TessLevelJob view;
+		GetTessLevelJob(view);
+
+		// Reused patches keep their old screen rects, which the debug display would show
+		bool reuse = (cacheTessLevels && !showScreenRects && tessLevelCacheValid &&
+				SameTessSettings(view, cachedTessView) && cachedSlefeBoxesGeneration == slefeBoxesGeneration);
+		bool sameView = (reuse && view.modelViewProjection == cachedTessView.modelViewProjection);
 
 		bool levelsOpen = false;
 		if (showDebugWindow)
+		{
+			ImGui::DragFloat("Mystery factor 2", &mysteryFactors[numSlefeDivs], 0.01);
 			levelsOpen = ImGui::TreeNode("Tess levels");
+		}
 
-		for (GLuint i = 0; i < NumTeapotVertices; ++i)
+		for (GLuint i = 0; i < model->numVertices; ++i)
 			vertexTessLevels[i] = 0;
 
-		int screenWidth, screenHeight;
-		glfwGetWindowSize(window.get(), &screenWidth, &screenHeight);
+		estimatedTriangles[slefeEnclosure] = 0;
+		numRecomputedPatches = 0;
+		adaptiveDivsRange[0] = maxSlefeDivs;
+		adaptiveDivsRange[1] = 0;
+
+		TessSpacing spacing = (fracTessLevels) ? TESS_FRACTIONAL_EVEN_SPACING : TESS_EQUAL_SPACING;
+		vec3 halfWindowSize = vec3(view.screenWidth / 2.0, view.screenHeight / 2.0, 0.5);
 
 		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
 		{
 			bool patchOpen = (levelsOpen && ImGui::TreeNode((string("Patch ") + std::to_string(patchIndex)).c_str()));
+			CachedTessLevel &cached = cachedTessLevels[patchIndex];
 
-			auto &pointBoxes = pointSlefeBoxes[patchIndex];
-			auto &tileBoxes = tileSlefeBoxes[patchIndex];
+			bool inside = cached.inside;
+			float screenScale = cached.screenScale;
+			bool recompute = !reuse;
+			if (reuse && !sameView)
+			{
+				screenScale = ProjectPatchBounds(patchIndex, view.modelViewProjection, halfWindowSize, inside);
 
-			float patchMaxScreenEdge = 0;
+				// Tiles may have been culled, or may be now
+				recompute = !(inside && cached.inside && cached.screenScale > 0);
+				recompute|= (adaptiveSlefeDivs && SelectSlefeDivs(screenScale) != cached.slefeDivs);
 
-			for (GLuint u = 0; u < numSlefeDivs; ++u)
-				for (GLuint v = 0; v < numSlefeDivs; ++v)
+				if (!recompute)
 				{
-					AABB tileBox = {vec3(INFINITY), vec3(-INFINITY)};
-					float tileMaxScreenEdge = tileBoxes[u][v].maxScreenEdge;
-
-					for (GLuint uOff = 0; uOff < 2; ++uOff)
-						for (GLuint vOff = 0; vOff < 2; ++vOff)
-						{
-							tileBox.min = min(pointBoxes[u + uOff][v + vOff].screenAxisBox.min, tileBox.min);
-							tileBox.max = max(pointBoxes[u + uOff][v + vOff].screenAxisBox.max, tileBox.max);
-
-							tileMaxScreenEdge = max(tileMaxScreenEdge, pointBoxes[u + uOff][v + vOff].maxScreenEdge);
-						}
-
-					if (tileBox.min.x > screenWidth || tileBox.min.y > screenHeight || tileBox.min.z > 1 ||
-							tileBox.max.x < 0 || tileBox.max.y < 0 || tileBox.max.z < 0)
-						continue;
-
-					if (patchOpen)
-						ImGui::Text("Tile[%u][%u] maxScreenEdge = %.2f", u, v, tileMaxScreenEdge);
+					// Levels grow with the square root of the screen size, as in ComputePatchTessLevel()
+					float predictedLevel = cached.computedLevel * sqrtf(screenScale / cached.screenScale);
+					recompute = (GetTessSegments(predictedLevel, spacing, maxTessGenLevel) >
+					             GetTessSegments(cached.level, spacing, maxTessGenLevel) ||
+					             predictedLevel < cached.level * (1 - levelHysteresis));
+				}
+			}
+			else if (!reuse)
+				screenScale = ProjectPatchBounds(patchIndex, view.modelViewProjection, halfWindowSize, inside);
 
-					patchMaxScreenEdge = max(tileMaxScreenEdge, patchMaxScreenEdge);
+			if (recompute)
+			{
+				float computedLevel;
+				if (adaptiveSlefeDivs)
+				{
+					cached.slefeDivs = SelectSlefeDivs(screenScale);
+					computedLevel = ComputeAdaptivePatchTessLevel(patchIndex, cached.slefeDivs, view, patchOpen);
+				}
+				else
+				{
+					PatchSlefeBoxes &boxes = patchSlefeBoxes[patchIndex];
+					ProjectSlefeBoxes(boxes, slefeEnclosure, numSlefeDivs, view.modelViewProjection, halfWindowSize,
+					                  boxes.pointBoxes, boxes.tileBoxes);
+					computedLevel = ComputePatchTessLevel(patchIndex, view.screenWidth, view.screenHeight, patchOpen);
 				}
 
-			static float mysteryFactor2 = 1.5;
-			static ImGuiOnceUponAFrame once;
-			if (showDebugWindow && once)
-				ImGui::DragFloat("Mystery factor 2", &mysteryFactor2, 0.01);
+				// Levels go up right away, but only come down once they're clearly too high, so they don't flicker
+				bool keep = (reuse && computedLevel < cached.level &&
+				             computedLevel >= cached.level * (1 - levelHysteresis));
+
+				cached.level = (keep) ? cached.level : computedLevel;
+				cached.computedLevel = computedLevel;
+				cached.screenScale = screenScale;
+				cached.inside = inside;
+				++numRecomputedPatches;
+			}
 
-			float tessLevel = numSlefeDivs * sqrtf(patchMaxScreenEdge / pixelAccuracy) * mysteryFactor2;
+			estimatedTriangles[slefeEnclosure]+= EstimatePatchTriangles(cached.level, fracTessLevels);
 
-			auto &levels = vertexTessLevels;
-			auto &indices = TeapotIndices[patchIndex];
+			SetPatchTessLevel(*model, vertexTessLevels, patchIndex, cached.level);
 
-			levels[indices[0][2]] = levels[indices[2][3]] = levels[indices[3][1]] = levels[indices[1][0]] = tessLevel;
-			levels[indices[1][1]] = tessLevel;
+			if (adaptiveSlefeDivs)
+			{
+				adaptiveDivsRange[0] = std::min(adaptiveDivsRange[0], cached.slefeDivs);
+				adaptiveDivsRange[1] = std::max(adaptiveDivsRange[1], cached.slefeDivs);
+			}
 
 			if (patchOpen)
 			{
-				ImGui::Text("Tess level = %.2f", tessLevel);
+				ImGui::Text("Tess level = %.2f%s", cached.level, (recompute) ? "" : " (reused)");
+				if (adaptiveSlefeDivs)
+					ImGui::Text("Divs = %u", cached.slefeDivs);
 				ImGui::TreePop();
 			}
 		}
 
 		if (levelsOpen)
 			ImGui::TreePop();
-	}
 
-	vec3
-	GetHullVertex(const HalfEdgeMesh &mesh, size_t index)
-	{
-		return vec3(mesh.m_vertices[index].x, mesh.m_vertices[index].y, mesh.m_vertices[index].z);
+		// The adaptive levels don't go through patchSlefeBoxes, whose screen rects the display shows
+		if (adaptiveSlefeDivs && showScreenRects)
+			ComputeSlefeRects(slefeEnclosure);
+
+		cachedTessView = view;
+		cachedSlefeBoxesGeneration = slefeBoxesGeneration;
+		tessLevelCacheValid = true;
 	}
 
-	vec3
-	ComputeFaceNormal(vec3 &a, vec3 &b, vec3 &c)
+	// The current view and level settings
+	void
+	GetTessLevelJob(TessLevelJob &job)
 	{
-		return normalize(cross(b - a, c - a));
+		job.modelViewProjection = projectionMatrix * modelViewMatrix;
+		glfwGetWindowSize(window.get(), &job.screenWidth, &job.screenHeight);
+		job.enclosure = slefeEnclosure;
+		job.patchRange[0] = patchRange[0];
+		job.patchRange[1] = patchRange[1];
+		job.numSlefeDivs = numSlefeDivs;
+		job.pixelAccuracy = pixelAccuracy;
+		job.mysteryFactor = mysteryFactors[numSlefeDivs];
+		job.fracTessLevels = fracTessLevels;
 	}
 
 	void
-	ComputeSlefeTiles()
+	RunTessLevelThread()
 	{
-		ComputeSlefeBoxes();
-
-		if (!slefeTilesChanged)
-			return;
+		std::unique_lock<std::mutex> lock(tessLevelWakeMutex);
 
-		slefeTileVertices.clear();
-		slefeTileIndices.clear();
+		while (!stopTessLevelThread)
+		{
+			// The render thread notifies without taking the mutex, so a wakeup can be missed; the timeout bounds that
+			if (!tessLevelJobs.Acquire())
+			{
+				tessLevelWake.wait_for(lock, std::chrono::milliseconds(1));
+				continue;
+			}
+
+			ComputeJobTessLevels(*model, patchSlefeBoxes, tessLevelJobs.GetReadBuffer(),
+			                     tessLevelResults.GetWriteBuffer());
+			tessLevelResults.Publish();
+		}
+	}
+
+	void
+	StopTessLevelThread()
+	{
+		if (!tessLevelThread.joinable())
+			return;
+
+		stopTessLevelThread = true;
+		tessLevelWake.notify_one();
+		tessLevelThread.join();
+
+		stopTessLevelThread = false;
+		tessLevelJobs.Reset();
+		tessLevelResults.Reset();
+		havePipelinedLevels = false;
+	}
+
+	// Levels for TESS_IPASS_PIPELINED, which lag the view by a frame or so. The render thread only waits for the worker
+	// when StopTessLevelThread() is called, before the slefe boxes change.
+	void
+	ComputePipelinedTessLevels(float vertexTessLevels[maxModelVertices])
+	{
+		ComputeSlefeBoxes();
+
+		TessLevelJob job;
+		GetTessLevelJob(job);
+
+		tessLevelJobs.GetWriteBuffer() = job;
+		tessLevelJobs.Publish();
+
+		if (tessLevelThread.joinable())
+			tessLevelWake.notify_one();
+		else
+			tessLevelThread = std::thread(&PixAccCurvedSurf::RunTessLevelThread, this);
+
+		havePipelinedLevels|= tessLevelResults.Acquire();
+
+		// Until the worker's first result, the levels are computed here
+		TessLevelResult syncResult;
+		if (!havePipelinedLevels)
+			ComputeJobTessLevels(*model, patchSlefeBoxes, job, syncResult);
+		const TessLevelResult &result = (havePipelinedLevels) ? tessLevelResults.GetReadBuffer() : syncResult;
+
+		std::copy(result.vertexTessLevels, result.vertexTessLevels + model->numVertices, vertexTessLevels);
+		estimatedTriangles[result.enclosure] = result.estimatedTriangles;
+	}
+
+	vec3
+	GetHullVertex(const HalfEdgeMesh &mesh, size_t index)
+	{
+		return vec3(mesh.m_vertices[index].x, mesh.m_vertices[index].y, mesh.m_vertices[index].z);
+	}
+
+	vec3
+	ComputeFaceNormal(vec3 &a, vec3 &b, vec3 &c)
+	{
+		return normalize(cross(b - a, c - a));
+	}
+
+	static bool
+	IsInsideAABB(const vec3 &point, const AABB &box)
+	{
+		for (GLuint dim = 0; dim < threeD; ++dim)
+			if (point[dim] < box.min[dim] || point[dim] > box.max[dim])
+				return false;
+
+		return true;
+	}
+
+	static bool
+	IsAABBCorner(const vec3 &point, const AABB &box)
+	{
+		for (GLuint dim = 0; dim < threeD; ++dim)
+			if (point[dim] != box.min[dim] && point[dim] != box.max[dim])
+				return false;
+
+		return true;
+	}
 
-		for (GLint patchIndex = 0; patchIndex < NumTeapotPatches; ++patchIndex)
+	// The hull of a tile is the hull of the union of its four corner point boxes, and any box corner that lies
+	// inside another of the boxes can't be a hull vertex, so only the rest are handed to QuickHull.
+	GLuint
+	GetTileHullCandidates(GLint patchIndex, GLuint udiv, GLuint vdiv, vec3 (&candidates)[2 * 2 * 8])
+	{
+		const AABB *boxes[2 * 2];
+		const vec3 *boxVertices[2 * 2];
+		for (GLuint i = 0; i < 2 * 2; ++i)
 		{
-			patchSlefeTileIndices[patchIndex][0] = slefeTileIndices.size();
+			boxes[i] = &patchSlefeBoxes[patchIndex].pointBoxes[udiv + i / 2][vdiv + i % 2].worldAxisBox;
+			boxVertices[i] = patchSlefeBoxes[patchIndex].pointVertices[ENCLOSURE_AXIS_BOX][udiv + i / 2][vdiv + i % 2];
+		}
 
-			for (GLuint udiv = 0; udiv < numSlefeDivs; ++udiv)
-				for (GLuint vdiv = 0; vdiv < numSlefeDivs; ++vdiv)
-				{
-					vec3 tilePoints[2][2][8];
-
-					for (GLuint uOff = 0; uOff < 2; ++uOff)
-						for (GLuint vOff = 0; vOff < 2; ++vOff)
-							bcopy(pointBoxVertices[patchIndex][udiv + uOff][vdiv + vOff],
-							      tilePoints[uOff][vOff],
-							      sizeof(pointBoxVertices[patchIndex][udiv + uOff][vdiv + vOff]));
-
-					QuickHull quickHull;
-					auto tileMesh = quickHull.getConvexHullAsMesh(value_ptr(tilePoints[0][0][0]),
-					                                              2 * 2 * 8,
-					                                              true,
-					                                              1e-7);
-
-					// It's pretty wasteful not to just build indices into the slefe box vertex list, but this is just
-					// for debug display.
-					for (auto &edge : tileMesh.m_halfEdges)
+		GLuint numCandidates = 0;
+		for (GLuint i = 0; i < 2 * 2; ++i)
+			for (GLuint corner = 0; corner < 8; ++corner)
+			{
+				const vec3 &vertex = boxVertices[i][corner];
+
+				bool redundant = false;
+				for (GLuint j = 0; j < 2 * 2 && !redundant; ++j)
+					if (j != i && IsInsideAABB(vertex, *boxes[j]))
 					{
-						auto &otherHalf = tileMesh.m_halfEdges[edge.m_opp];
+						// A corner shared by two boxes is kept from the first one only
+						redundant = (j < i || !IsAABBCorner(vertex, *boxes[j]));
+					}
+
+				if (!redundant)
+					candidates[numCandidates++] = vertex;
+			}
 
-						if (edge.m_endVertex > otherHalf.m_endVertex)
-							continue;
+		return numCandidates;
+	}
+
+	void
+	ComputePatchSlefeTiles(GLint patchIndex, vector<vec3> &edgeVertices)
+	{
+		for (GLuint udiv = 0; udiv < numSlefeDivs; ++udiv)
+			for (GLuint vdiv = 0; vdiv < numSlefeDivs; ++vdiv)
+			{
+				vec3 tilePoints[2 * 2 * 8];
+				GLuint numTilePoints = GetTileHullCandidates(patchIndex, udiv, vdiv, tilePoints);
 
-						vec3 vertex = GetHullVertex(tileMesh, edge.m_endVertex);
-						vec3 otherVertex = GetHullVertex(tileMesh, otherHalf.m_endVertex);
+				QuickHull quickHull;
+				auto tileMesh = quickHull.getConvexHullAsMesh(value_ptr(tilePoints[0]), numTilePoints, true, 1e-7);
 
-						HalfEdgeMesh::HalfEdge &nextEdge = tileMesh.m_halfEdges[edge.m_next];
-						vec3 thirdVertex = GetHullVertex(tileMesh, nextEdge.m_endVertex);
-						HalfEdgeMesh::HalfEdge &otherNextEdge = tileMesh.m_halfEdges[otherHalf.m_next];
-						vec3 otherThirdVertex = GetHullVertex(tileMesh, otherNextEdge.m_endVertex);
+				// It's pretty wasteful not to just build indices into the slefe box vertex list, but this is just
+				// for debug display.
+				for (auto &edge : tileMesh.m_halfEdges)
+				{
+					auto &otherHalf = tileMesh.m_halfEdges[edge.m_opp];
 
-						vec3 faceNormal = ComputeFaceNormal(vertex, otherVertex, thirdVertex);
-						vec3 otherFaceNormal = ComputeFaceNormal(otherVertex, vertex, otherThirdVertex);
+					if (edge.m_endVertex > otherHalf.m_endVertex)
+						continue;
 
-						// If this edge separates two faces on the same plane, don't display it in wireframe
-						if (dot(faceNormal, otherFaceNormal) >= 1.0 - 1e-6)
-							continue;
+					vec3 vertex = GetHullVertex(tileMesh, edge.m_endVertex);
+					vec3 otherVertex = GetHullVertex(tileMesh, otherHalf.m_endVertex);
 
-						slefeTileIndices.push_back(slefeTileVertices.size());
-						slefeTileVertices.push_back(vertex);
-						slefeTileIndices.push_back(slefeTileVertices.size());
-						slefeTileVertices.push_back(otherVertex);
-					}
+					HalfEdgeMesh::HalfEdge &nextEdge = tileMesh.m_halfEdges[edge.m_next];
+					vec3 thirdVertex = GetHullVertex(tileMesh, nextEdge.m_endVertex);
+					HalfEdgeMesh::HalfEdge &otherNextEdge = tileMesh.m_halfEdges[otherHalf.m_next];
+					vec3 otherThirdVertex = GetHullVertex(tileMesh, otherNextEdge.m_endVertex);
+
+					vec3 faceNormal = ComputeFaceNormal(vertex, otherVertex, thirdVertex);
+					vec3 otherFaceNormal = ComputeFaceNormal(otherVertex, vertex, otherThirdVertex);
+
+					// If this edge separates two faces on the same plane, don't display it in wireframe
+					if (dot(faceNormal, otherFaceNormal) >= 1.0 - 1e-6)
+						continue;
+
+					edgeVertices.push_back(vertex);
+					edgeVertices.push_back(otherVertex);
 				}
+			}
+	}
+
+	void
+	ComputeSlefeTiles()
+	{
+		ComputeSlefeBoxes();
+
+		if (!slefeTilesChanged)
+			return;
+
+		// Patches are independent, so build their hulls in parallel and concatenate them afterwards
+		vector<vec3> patchEdgeVertices[maxModelPatches];
+		ParallelFor(0, model->numPatches, [&](GLint patchIndex)
+		{
+			ComputePatchSlefeTiles(patchIndex, patchEdgeVertices[patchIndex]);
+		});
+
+		slefeTileVertices.clear();
+		slefeTileIndices.clear();
+
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+		{
+			patchSlefeTileIndices[patchIndex][0] = slefeTileIndices.size();
+
+			for (const vec3 &vertex : patchEdgeVertices[patchIndex])
+			{
+				slefeTileIndices.push_back(slefeTileVertices.size());
+				slefeTileVertices.push_back(vertex);
+			}
 
 			patchSlefeTileIndices[patchIndex][1] = slefeTileVertices.size();
 		}
@@ -651,32 +1575,10 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 	}
 
 	void
-	GetAABBVertices(const AABB &box, vec3 vertices[8])
-	{
-#if 0
-		for (GLuint i = 0; i < 8; ++i)
-			vertices[i] = vec3((i & 1) ? box.min.x : box.max.x,
-			                   (i & 2) ? box.min.y : box.max.y,
-			                   (i & 4) ? box.min.z : box.max.z);
-#else
-		vertices[0] = box.min;
-		vertices[1] = vec3(box.min.x, box.min.y, box.max.z);
-		vertices[2] = vec3(box.min.x, box.max.y, box.max.z);
-		vertices[3] = vec3(box.min.x, box.max.y, box.min.z);
-		vertices[4] = vec3(box.max.x, box.min.y, box.min.z);
-		vertices[5] = vec3(box.max.x, box.min.y, box.max.z);
-		vertices[6] = box.max;
-		vertices[7] = vec3(box.max.x, box.max.y, box.min.z);
-#endif // 0
-	}
-
-	void
-	RenderAABBWireframe(const AABB &box, vector<vec3> &vertices, vector<GLuint> &indices)
+	RenderBoxWireframe(const vec3 boxVertices[8], vector<vec3> &vertices, vector<GLuint> &indices)
 	{
 		GLuint startIndex = vertices.size();
-		vertices.resize(startIndex + 8);
-
-		GetAABBVertices(box, vertices.data() + startIndex);
+		vertices.insert(vertices.end(), boxVertices, boxVertices + 8);
 
 		for (GLuint i = 0; i < 4; ++i)
 		{
@@ -690,6 +1592,14 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		}
 	}
 
+	void
+	RenderAABBWireframe(const AABB &box, vector<vec3> &vertices, vector<GLuint> &indices)
+	{
+		vec3 boxVertices[8];
+		GetAABBVertices(box, boxVertices);
+		RenderBoxWireframe(boxVertices, vertices, indices);
+	}
+
 	void
 	DebugAABB(const char *name, GLuint u, GLuint v, const AABB &box)
 	{
@@ -712,8 +1622,9 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 			if (slefeNodesOpen)
 				patchOpen = ImGui::TreeNode((string("Slefe box ") + std::to_string(patchIndex)).c_str());
 
-			auto &pointBoxes = pointSlefeBoxes[patchIndex];
-			auto &tileBoxes = tileSlefeBoxes[patchIndex];
+			const PatchSlefeBoxes &boxes = patchSlefeBoxes[patchIndex];
+			auto &pointBoxes = boxes.pointBoxes;
+			auto &tileBoxes = boxes.tileBoxes;
 
 			for (GLuint u = 0; u <= numSlefeDivs; ++u)
 				for (GLuint v = 0; v <= numSlefeDivs; ++v)
@@ -727,7 +1638,13 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 					}
 
 					if (showSlefeBoxes)
-						RenderAABBWireframe(pointBox.worldAxisBox, boxVertices, boxIndices);
+					{
+						if (slefeEnclosure == ENCLOSURE_TANGENT_BOX)
+							RenderBoxWireframe(boxes.pointVertices[ENCLOSURE_TANGENT_BOX][u][v], boxVertices,
+							                   boxIndices);
+						else
+							RenderAABBWireframe(pointBox.worldAxisBox, boxVertices, boxIndices);
+					}
 
 					if (showScreenRects)
 						RenderAABBWireframe(pointBox.screenAxisBox, boxVertices, screenRectIndices);
@@ -743,7 +1660,13 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 						}
 
 						if (showSlefeBoxes)
-							RenderAABBWireframe(tileBox.worldAxisBox, boxVertices, boxIndices);
+						{
+							if (slefeEnclosure == ENCLOSURE_TANGENT_BOX)
+								RenderBoxWireframe(boxes.tileVertices[ENCLOSURE_TANGENT_BOX][u][v], boxVertices,
+								                   boxIndices);
+							else
+								RenderAABBWireframe(tileBox.worldAxisBox, boxVertices, boxIndices);
+						}
 
 						if (showScreenRects)
 							RenderAABBWireframe(tileBox.screenAxisBox, boxVertices, screenRectIndices);
@@ -814,33 +1737,306 @@ class PixAccCurvedSurf : public GLFWWindowedApp
 		glDisable(GL_POLYGON_OFFSET_POINT);
 	}
 
+	// The whole model, or nothing with pageClusters, where the clusters' control points are copied into the pool
+	void
+	UploadControlPointBuffer()
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINTS]);
+		if (pageClusters)
+			glBufferData(GL_ARRAY_BUFFER, 0, NULL, GL_STATIC_DRAW);
+		else if (quantizeControlPoints)
+			glBufferData(GL_ARRAY_BUFFER, quantizedVertices.size() * sizeof(quantizedVertices[0]),
+			             quantizedVertices.data(), GL_STATIC_DRAW);
+		else
+			glBufferData(GL_ARRAY_BUFFER, model->numVertices * sizeof(model->vertices[0]), model->vertices,
+			             GL_STATIC_DRAW);
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINT_BOXES]);
+		if (quantizeControlPoints && !pageClusters)
+			glBufferData(GL_ARRAY_BUFFER, model->numPatches * sizeof(controlPointBoxes[0]), controlPointBoxes,
+			             GL_STATIC_DRAW);
+		else
+			glBufferData(GL_ARRAY_BUFFER, 0, NULL, GL_STATIC_DRAW);
+	}
+
+	// The smallest power of two that's at least value
+	static float
+	CeilPowerOfTwo(float value)
+	{
+		int exponent;
+		float mantissa = std::frexp(max(value, std::numeric_limits<float>::min()), &exponent);
+		return std::ldexp(1.0f, (mantissa == 0.5f) ? exponent - 1 : exponent);
+	}
+
+	// Quantizes each patch's control points to 16 bits per coordinate against a box of its own, in steps of a power
+	// of two, which makes the decoding exact. A control point shared between patches is rounded to the largest of
+	// their steps, so that it decodes to the same float in each of them, and the patches still meet. That can take a
+	// patch's rounded points past what its step spans, which doubles the step and goes around again.
+	void
+	QuantizeControlPoints()
+	{
+		static const float maxValue = 65535;
+		GLuint numPatchVertices = model->GetNumPatchVertices();
+
+		auto getVertex = [&](GLint patchIndex, GLuint i)
+		{
+			const float *vertex = model->vertices[model->GetPatchIndices(patchIndex)[i]];
+			return vec3(vertex[0], vertex[1], vertex[2]);
+		};
+
+		// Also coarse enough that every multiple of the step up to the points' magnitude is a float
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+		{
+			vec3 boundsMin(INFINITY), boundsMax(-INFINITY);
+			for (GLuint i = 0; i < numPatchVertices; ++i)
+			{
+				boundsMin = min(boundsMin, getVertex(patchIndex, i));
+				boundsMax = max(boundsMax, getVertex(patchIndex, i));
+			}
+
+			vec3 magnitude = max(abs(boundsMin), abs(boundsMax));
+			for (GLuint dim = 0; dim < threeD; ++dim)
+			{
+				float step = max((boundsMax[dim] - boundsMin[dim]) / maxValue, std::ldexp(magnitude[dim], -22));
+				controlPointBoxes[patchIndex].step[dim] = CeilPowerOfTwo(step);
+			}
+		}
+
+		vector<vec3> vertexSteps(model->numVertices), roundedVertices(model->numVertices);
+		for (bool changed = true; changed; )
+		{
+			std::fill(vertexSteps.begin(), vertexSteps.end(), vec3(0));
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+				for (GLuint i = 0; i < numPatchVertices; ++i)
+				{
+					vec3 &step = vertexSteps[model->GetPatchIndices(patchIndex)[i]];
+					step = max(step, controlPointBoxes[patchIndex].step);
+				}
+
+			for (GLuint vertex = 0; vertex < model->numVertices; ++vertex)
+			{
+				for (GLuint dim = 0; dim < threeD; ++dim)
+				{
+					float step = vertexSteps[vertex][dim];
+					roundedVertices[vertex][dim] = std::round(model->vertices[vertex][dim] / step) * step;
+				}
+			}
+
+			changed = false;
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			{
+				ControlPointBox &box = controlPointBoxes[patchIndex];
+				vec3 boundsMin(INFINITY), boundsMax(-INFINITY);
+				for (GLuint i = 0; i < numPatchVertices; ++i)
+				{
+					boundsMin = min(boundsMin, roundedVertices[model->GetPatchIndices(patchIndex)[i]]);
+					boundsMax = max(boundsMax, roundedVertices[model->GetPatchIndices(patchIndex)[i]]);
+				}
+
+				// A multiple of the step, like all of the rounded points
+				box.origin = boundsMin;
+				for (GLuint dim = 0; dim < threeD; ++dim)
+					if ((boundsMax[dim] - boundsMin[dim]) / box.step[dim] > maxValue)
+					{
+						box.step[dim]*= 2;
+						changed = true;
+					}
+			}
+		}
+
+		// Padded to whole words for SlefeBuffers.glsl
+		quantizedVertices.assign((model->numPatches * numPatchVertices * threeD + 1) / 2 * 2, 0);
+		quantizationError = vec3(0);
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+		{
+			ControlPointBox &box = controlPointBoxes[patchIndex];
+			box.error = vec3(0);
+			for (GLuint i = 0; i < numPatchVertices; ++i)
+			{
+				vec3 rounded = roundedVertices[model->GetPatchIndices(patchIndex)[i]];
+				vec3 value = (rounded - box.origin) / box.step;
+				for (GLuint dim = 0; dim < threeD; ++dim)
+					quantizedVertices[(patchIndex * numPatchVertices + i) * threeD + dim] = GLushort(value[dim]);
+
+				// Plus an ulp of the point, for the rounding of the difference
+				vec3 vertex = getVertex(patchIndex, i);
+				box.error = max(box.error, abs(vertex - rounded) + abs(vertex) * std::numeric_limits<float>::epsilon());
+			}
+			quantizationError = max(quantizationError, box.error);
+		}
+	}
+
+	// Uploads the model's control points, quantized with quantizeControlPoints, and drops everything computed from the
+	// ones there before
+	void
+	UploadControlPoints()
+	{
+		StopTessLevelThread();
+
+		if (quantizeControlPoints)
+			QuantizeControlPoints();
+		else
+		{
+			quantizedVertices.clear();
+			quantizationError = vec3(0);
+		}
+
+		UploadControlPointBuffer();
+
+		// Of the decoded control points, whose hull holds the rendered patch
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+		{
+			patchBounds[patchIndex] = {vec3(INFINITY), vec3(-INFINITY)};
+			for (GLuint i = 0; i < model->GetNumPatchVertices(); ++i)
+			{
+				vec3 vertex = GetControlPoint(patchIndex, i);
+				patchBounds[patchIndex].min = min(patchBounds[patchIndex].min, vertex);
+				patchBounds[patchIndex].max = max(patchBounds[patchIndex].max, vertex);
+			}
+		}
+
+		slefesChanged = true;
+		for (auto &patchCaches : patchSlefeCaches)
+			for (auto &cache : patchCaches)
+				cache.reset();
+		tessLevelCacheValid = false;
+		slefeBoxBufferChanged = true;
+
+		// Empty slots, so the first capture lays them out
+		for (auto &patch : capturedPatches)
+			patch = CapturedPatch();
+
+		// The compute programs depend on the kind of patches and on how their control points are stored, and the
+		// slefe table on the kind of patches
+		slefeComputeProgram.reset();
+		levelComputeProgram.reset();
+		computedSlefeDivs = 0;
+
+		// From the new patch bounds, and the pool's control points are in the old format
+		BuildPatchClusters();
+	}
+
+	// Clusters the patches in patchRange, and empties the pool
+	void
+	BuildPatchClusters()
+	{
+		ClusterPatches(*model, patchBounds, patchRange[0], patchRange[1], patchClusters);
+
+		poolClusters.assign(numPoolSlots, -1);
+		poolSlefeBoxesValid = false;
+	}
+
+	// Its size only depends on numPoolSlots, never on the model
+	void
+	AllocateClusterPool()
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_POOL_CONTROL_POINTS]);
+		glBufferData(GL_ARRAY_BUFFER, numPoolSlots * poolSlotVertices * threeD * sizeof(GLfloat), NULL,
+		             GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_POOL_TESS_LEVELS]);
+		glBufferData(GL_ARRAY_BUFFER, numPoolSlots * poolSlotVertices * sizeof(GLfloat), NULL, GL_STREAM_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_POOL_INDICES]);
+		glBufferData(GL_ARRAY_BUFFER, numPoolSlots * poolSlotVertices * sizeof(GLuint), NULL, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_POOL_CONTROL_POINT_BOXES]);
+		glBufferData(GL_ARRAY_BUFFER, numPoolSlots * clusterPatches * sizeof(ControlPointBox), NULL, GL_DYNAMIC_DRAW);
+
+		for (auto &cluster : patchClusters)
+			cluster.slot = -1;
+		poolClusters.assign(numPoolSlots, -1);
+		poolSlefeBoxesValid = false;
+	}
+
+	// Uploads one of patchModels, and drops everything computed from the previous one. Models with more control points
+	// per patch than the GL implementation takes are rejected, keeping the previous one.
+	void
+	LoadModel(int index)
+	{
+		if (patchModels[index].GetNumPatchVertices() > GLuint(patchVertexLimit))
+		{
+			clog << modelNames[index] << " has " << patchModels[index].GetNumPatchVertices() <<
+					" control points per patch, more than the GL_MAX_PATCH_VERTICES of " << patchVertexLimit << endl;
+			modelIndex = model - patchModels;
+			return;
+		}
+
+		StopTessLevelThread();
+
+		modelIndex = index;
+		model = &patchModels[index];
+
+		// Before the clusters are built, from the patches in range
+		patchRange[0] = 0;
+		patchRange[1] = model->numPatches;
+
+		UploadControlPoints();
+
+		modelCentroid = GetModelCentroid(*model);
+
+		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_MODEL]);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINT_INDICES]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, model->numPatches * model->GetNumPatchVertices() * sizeof(GLuint),
+		             model->indices, GL_STATIC_DRAW);
+		glPatchParameteri(GL_PATCH_VERTICES, model->GetNumPatchVertices());
+
+		patchEdgeSides.clear();
+		FindPatchEdges();
+
+		ResetHiZPyramid();
+		RebuildMainProgram();
+	}
+
 public:
-	PixAccCurvedSurf() : GLFWWindowedApp("PixAccCurvedSurf")
+	PixAccCurvedSurf() : GLFWWindowedApp("PixAccCurvedSurf"), precompileContext(nullptr, glfwDestroyWindow)
 	{
 		glGenVertexArrays(NUM_VERTEX_ARRAYS, vertexArrayObjects);
-		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_TEAPOT]);
+		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_MODEL]);
 
 		glGenBuffers(NUM_BUFFERS, buffers);
 
-		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINTS]);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(TeapotVertices), TeapotVertices, GL_STATIC_DRAW);
+		// Only 4.1 is requested, but drivers usually give a later version when one is available
+		GLint majorVersion, minorVersion;
+		glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+		glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+		computeSupported = (majorVersion > 4 || (majorVersion == 4 && minorVersion >= 3));
+		glGetIntegerv(GL_MAX_PATCH_VERTICES, &patchVertexLimit);
+
+		if (computeSupported)
+		{
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_SLEFE_POINTS]);
+			glBufferData(GL_SHADER_STORAGE_BUFFER,
+			             maxModelPatches * Slefe::NUM_BOUNDS * (maxSlefeDivs + 1) * (maxSlefeDivs + 1) * sizeof(vec4),
+			             NULL, GL_DYNAMIC_COPY);
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_PATCH_LEVELS]);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, maxModelPatches * sizeof(GLfloat), NULL, GL_DYNAMIC_COPY);
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_VISIBLE_INDICES]);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, maxModelPatches * maxPatchVertices * sizeof(GLuint), NULL,
+			             GL_DYNAMIC_COPY);
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		}
 
-		modelCentroid = vec3(0);
-		for (GLuint i = 0; i < NumTeapotVertices; ++i)
-			modelCentroid+= vec3(0/*TeapotVertices[i][0]*/, TeapotVertices[i][1], 0/*TeapotVertices[i][2]*/);
-		modelCentroid/= NumTeapotVertices;
+		shaderCacheDir = CreateShaderCacheDir();
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINT_INDICES]);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(TeapotIndices), TeapotIndices, GL_STATIC_DRAW);
+		// Before LoadModel(), whose RebuildMainProgram() puts it in replayPipeline
+		replayProgram.reset(new ShaderProgram("#version 410 core\n"));
+		replayProgram->SetBinaryCache(shaderCacheDir);
+		replayProgram->SetSeparable();
+		replayProgram->Include("Uniforms.glsl");
+		replayProgram->LoadShader(GL_VERTEX_SHADER, "Replay.vert");
+		replayProgram->Link();
+		replayProgram->BindUniformBlock("FrameUniforms", UNIFORM_BLOCK_FRAME);
+		replayPipeline.UseStages(*replayProgram);
 
-		RebuildMainProgram();
+		glGenTransformFeedbacks(maxModelPatches, captureFeedbacks);
 
-		glPatchParameteri(GL_PATCH_VERTICES, NumTeapotVerticesPerPatch);
+		AllocateClusterPool();
+
+		LoadModel(MODEL_TEAPOT);
 
 		debugProgram.LoadShader(GL_VERTEX_SHADER, "Debug.vert");
 		debugProgram.LoadShader(GL_FRAGMENT_SHADER, "UniformColor.frag");
 
 		debugProgram.Link();
+		debugColorLocation = debugProgram.GetUniformLocation("Color");
 
 		setenv("SUBLIMEPATH", ".", false);
 		InitBounds();
@@ -853,19 +2049,51 @@ public:
 		glEnable(GL_DEPTH_TEST);
 
 		glGenTextures(1, &texture);
+		CreateCheckerTexture();
 		UpdateTexture();
 
+		glGenTextures(1, &slefeBoxTexture);
+		glGenTextures(1, &poolSlefeBoxTexture);
+		glGenTextures(1, &controlPointBoxTexture);
+		glGenTextures(1, &sharedVertexTexture);
+		glGenTextures(1, &sharedTessLevelTexture);
+
 		glGenQueries(NUM_QUERIES, queries);
+		glGenQueries(maxModelPatches, occlusionQueries);
 
 		CheckGLErrors("PixAccCurvedSurf()");
+
+		precompileContext = CreateSharedContext();
+		precompileThread = std::thread(&PixAccCurvedSurf::PrecompileMainPrograms, this, model,
+		                               bezierPatchMethod);
 	}
 
 	~PixAccCurvedSurf()
 	{
+		stopPrecompile = true;
+		precompileThread.join();
+
+		StopTessLevelThread();
+
 		glDeleteTextures(1, &texture);
+		glDeleteTextures(1, &slefeBoxTexture);
+		glDeleteTextures(1, &poolSlefeBoxTexture);
+		glDeleteTextures(1, &controlPointBoxTexture);
+		glDeleteTextures(1, &sharedVertexTexture);
+		glDeleteTextures(1, &sharedTessLevelTexture);
 
+		glDeleteQueries(maxModelPatches, occlusionQueries);
 		glDeleteQueries(NUM_QUERIES, queries);
 
+		glDeleteTransformFeedbacks(maxModelPatches, captureFeedbacks);
+
+		ResetHiZPyramid();
+		if (hiZFramebuffer)
+		{
+			glDeleteFramebuffers(1, &hiZFramebuffer);
+			glDeleteRenderbuffers(1, &hiZRenderbuffer);
+		}
+
 		CheckGLErrors("~PixAccCurvedSurf()");
 	}
 
@@ -879,146 +2107,1331 @@ public:
 
 		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
 		{
-			Slefe &slefe = slefes[patchIndex];
-			auto &pointBoxes = pointSlefeBoxes[patchIndex];
-			auto &tileBoxes = tileSlefeBoxes[patchIndex];
+			vec3 controlPoints[maxPatchVertices];
+			GetPatchControlPoints(patchIndex, controlPoints);
 
-			for (GLuint u = 0; u <= numSlefeDivs; ++u)
-				for (GLuint v = 0; v <= numSlefeDivs; ++v)
-				{
-					struct SlefeBox &pointBox = pointBoxes[u][v];
+			ComputePatchSlefeBoxes(*model, controlPoints, GetControlPointError(patchIndex), numSlefeDivs,
+			                       singlePrecisionSlefes, slefes[patchIndex], patchSlefeBoxes[patchIndex]);
+		}
 
-					vec3 &lower = slefe.bounds[Slefe::LOWER].points[u][v];
-					vec3 &upper = slefe.bounds[Slefe::UPPER].points[u][v];
+		slefeBoxesChanged = false;
+		slefeTilesChanged = true;
+		slefeBoxBufferChanged = true;
+		++slefeBoxesGeneration;
+	}
 
-					pointBox.worldAxisBox.min = min(lower, upper);
-					pointBox.worldAxisBox.max = max(lower, upper);
+	void
+	ComputeSlefeRects(int enclosure)
+	{
+		ComputeSlefeBoxes();
 
-					GetAABBVertices(pointBox.worldAxisBox, pointBoxVertices[patchIndex][u][v]);
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+		vec3 halfWindowSize = vec3(width / 2.0, height / 2.0, 0.5);
+		mat4 modelViewProjection = projectionMatrix * modelViewMatrix;
 
-					if (u < numSlefeDivs && v < numSlefeDivs)
+		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+			ProjectSlefeBoxes(patchSlefeBoxes[patchIndex], enclosure, numSlefeDivs, modelViewProjection, halfWindowSize,
+			                  patchSlefeBoxes[patchIndex].pointBoxes, patchSlefeBoxes[patchIndex].tileBoxes);
+	}
+
+	// Degree of the patches' boundary curves along an edge, with edges in the order of the outer tess levels
+	GLuint
+	GetEdgeDegree(GLint edge)
+	{
+		return model->degree[edge % 2];
+	}
+
+	// Control point index of a patch, i along an edge and depth in from it
+	GLuint
+	GetEdgeControlPoint(GLint patchIndex, GLint edge, GLuint i, GLuint depth = 0)
+	{
+		switch (edge)
+		{
+			case 0: return model->GetIndex(patchIndex, i, depth);
+			case 1: return model->GetIndex(patchIndex, depth, i);
+			case 2: return model->GetIndex(patchIndex, i, model->degree[1] - depth);
+			default: return model->GetIndex(patchIndex, model->degree[0] - depth, i);
+		}
+	}
+
+	// Control point i of the boundary curve along an edge. That of a B-spline span is a B-spline curve too, with each
+	// control point averaged from the 3 nearest the edge; the outer two are summed first, so that the span on the
+	// other side, which has them the other way around, gets the very same point.
+	vec3
+	GetEdgeCurvePoint(GLint patchIndex, GLint edge, GLuint i)
+	{
+		vec3 points[3];
+		for (GLuint depth = 0; depth < ((model->bSpline) ? 3 : 1); ++depth)
+		{
+			const float *vertex = model->vertices[GetEdgeControlPoint(patchIndex, edge, i, depth)];
+			points[depth] = vec3(vertex[0], vertex[1], vertex[2]);
+		}
+
+		if (!model->bSpline)
+			return points[0];
+
+		return ((points[0] + points[2]) + 4.0f * points[1]) / 6.0f;
+	}
+
+	// Patches with the same boundary curve share an edge, whichever direction they run along it
+	void
+	FindPatchEdges()
+	{
+		std::map<vector<float>, GLuint> edgeIds;
+
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			for (GLint edge = 0; edge < 4; ++edge)
+			{
+				GLuint degree = GetEdgeDegree(edge);
+				vector<float> key((degree + 1) * threeD), reversedKey((degree + 1) * threeD);
+				for (GLuint i = 0; i <= degree; ++i)
+				{
+					vec3 point = GetEdgeCurvePoint(patchIndex, edge, i);
+					for (GLuint dim = 0; dim < threeD; ++dim)
 					{
-						auto &tileBox = tileBoxes[u][v];
+						key[i * threeD + dim] = point[dim];
+						reversedKey[(degree - i) * threeD + dim] = point[dim];
+					}
+				}
 
-						tileBox.worldAxisBox.min = vec3(INFINITY);
-						tileBox.worldAxisBox.max = vec3(-INFINITY);
+				auto inserted = edgeIds.emplace(std::min(key, reversedKey), GLuint(patchEdgeSides.size()));
+				if (inserted.second)
+					patchEdgeSides.emplace_back();
 
-						for (GLuint mid = 0; mid < 2; ++mid)
-						{
-							auto &midPoints = slefe.midPoints[u][v][mid];
+				patchEdges[patchIndex][edge] = inserted.first->second;
+				patchEdgeSides[inserted.first->second].emplace_back(patchIndex, edge);
+			}
+	}
+
+	// Slefe array indices of the k-th point or tile along an edge, where last is numSlefeDivs for points and
+	// numSlefeDivs - 1 for tiles
+	static void
+	GetEdgeSlefeIndices(GLint edge, GLuint k, GLuint last, GLuint &u, GLuint &v)
+	{
+		switch (edge)
+		{
+			case 0: u = k; v = 0; break;
+			case 1: u = 0; v = k; break;
+			case 2: u = k; v = last; break;
+			default: u = last; v = k; break;
+		}
+	}
+
+	// A point or tile's enclosure as a parallelepiped: the center, then the three half axes
+	void
+	GetSlefeBoxTexels(int enclosure, GLint patchIndex, bool tile, GLuint u, GLuint v, vec4 texels[4])
+	{
+		const PatchSlefeBoxes &boxes = patchSlefeBoxes[patchIndex];
+		const SlefeBox &box = (tile) ? boxes.tileBoxes[u][v] : boxes.pointBoxes[u][v];
+
+		vec3 center, axes[3];
+		switch (enclosure)
+		{
+			case ENCLOSURE_AXIS_BOX:
+			{
+				vec3 halfExtents = (box.worldAxisBox.max - box.worldAxisBox.min) * 0.5f;
+				center = (box.worldAxisBox.min + box.worldAxisBox.max) * 0.5f;
+				axes[0] = vec3(halfExtents.x, 0, 0);
+				axes[1] = vec3(0, halfExtents.y, 0);
+				axes[2] = vec3(0, 0, halfExtents.z);
+				break;
+			}
+
+			case ENCLOSURE_TANGENT_BOX:
+				center = box.tangentBox.center;
+				for (GLuint axis = 0; axis < threeD; ++axis)
+					axes[axis] = box.tangentBox.axes[axis] * box.tangentBox.halfExtents[axis];
+				break;
+
+			default:
+				assert(!"Invalid enclosure");
+		}
+
+		texels[0] = vec4(center, 1);
+		for (GLuint axis = 0; axis < threeD; ++axis)
+			texels[1 + axis] = vec4(axes[axis], 0);
+	}
+
+	// Of each patch in the layout of UploadSlefeBoxes()
+	GLuint
+	GetPatchSlefeTexels() const
+	{
+		GLuint n = numSlefeDivs;
+		return 2 + ((n + 1) * (n + 1) + n * n) * slefeBoxTexels;
+	}
+
+	// The boxes along an edge from every patch sharing it, and returns how many
+	GLuint
+	AppendEdgeSlefeBoxTexels(GLuint edgeId, vector<vec4> &texels)
+	{
+		GLuint n = numSlefeDivs;
+		GLuint numBoxes = 0;
+		for (auto &side : patchEdgeSides[edgeId])
+			for (GLuint k = 0; k <= n; ++k)
+				for (bool tile : {false, true})
+				{
+					if (tile && k == n)
+						continue;
+
+					GLuint u, v;
+					GetEdgeSlefeIndices(side.second, k, (tile) ? n - 1 : n, u, v);
+
+					texels.resize(texels.size() + slefeBoxTexels);
+					GetSlefeBoxTexels(slefeEnclosure, side.first, tile, u, v, &texels[texels.size() - slefeBoxTexels]);
+					++numBoxes;
+				}
+
+		return numBoxes;
+	}
+
+	// A patch's texels, given where the boxes along each of its edges start and how many there are
+	void
+	GetPatchSlefeBoxTexels(GLint patchIndex, const GLuint edgeStarts[4], const GLuint edgeBoxCounts[4],
+			vec4 *patchTexels)
+	{
+		GLuint n = numSlefeDivs;
+		GLuint numPoints = (n + 1) * (n + 1);
+
+		for (GLuint edge = 0; edge < 4; ++edge)
+		{
+			patchTexels[0][edge] = edgeStarts[edge];
+			patchTexels[1][edge] = edgeBoxCounts[edge];
+		}
+
+		vec4 *pointTexels = patchTexels + 2;
+		vec4 *tileTexels = pointTexels + numPoints * slefeBoxTexels;
+		for (GLuint u = 0; u <= n; ++u)
+			for (GLuint v = 0; v <= n; ++v)
+			{
+				GLuint point = u * (n + 1) + v;
+				GetSlefeBoxTexels(slefeEnclosure, patchIndex, false, u, v, pointTexels + point * slefeBoxTexels);
+
+				if (u < n && v < n)
+					GetSlefeBoxTexels(slefeEnclosure, patchIndex, true, u, v, tileTexels + (u * n + v) * slefeBoxTexels);
+			}
+	}
+
+	// Layout read by iPASS.tesc: for each patch, a texel with the start of each edge's boxes and one with their counts,
+	// then the point boxes and the tile boxes. After all patches come the edges, each with the boxes along it from
+	// every patch sharing it, so that both sides compute the same outer level. With pageClusters, the boxes go in the
+	// pool instead.
+	void
+	UploadSlefeBoxes()
+	{
+		ComputeSlefeBoxes();
+
+		if (pageClusters)
+		{
+			if (slefeBoxBufferChanged || !poolSlefeBoxesValid)
+				AllocatePoolSlefeBoxes();
+			slefeBoxBufferChanged = false;
+			return;
+		}
+
+		if (!slefeBoxBufferChanged)
+			return;
+
+		GLuint patchStride = GetPatchSlefeTexels();
+
+		vector<vec4> texels(model->numPatches * patchStride);
+		vector<GLuint> edgeStarts, edgeBoxCounts;
+
+		for (GLuint edgeId = 0; edgeId < patchEdgeSides.size(); ++edgeId)
+		{
+			edgeStarts.push_back(texels.size());
+			edgeBoxCounts.push_back(AppendEdgeSlefeBoxTexels(edgeId, texels));
+		}
+
+		for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+		{
+			GLuint patchEdgeStarts[4], patchEdgeBoxCounts[4];
+			for (GLuint edge = 0; edge < 4; ++edge)
+			{
+				patchEdgeStarts[edge] = edgeStarts[patchEdges[patchIndex][edge]];
+				patchEdgeBoxCounts[edge] = edgeBoxCounts[patchEdges[patchIndex][edge]];
+			}
+
+			GetPatchSlefeBoxTexels(patchIndex, patchEdgeStarts, patchEdgeBoxCounts, &texels[patchIndex * patchStride]);
+		}
+
+		glBindBuffer(GL_TEXTURE_BUFFER, buffers[BUFFER_SLEFE_BOXES]);
+		glBufferData(GL_TEXTURE_BUFFER, texels.size() * sizeof(texels[0]), texels.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		glBindTexture(GL_TEXTURE_BUFFER, slefeBoxTexture);
+		glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffers[BUFFER_SLEFE_BOXES]);
+		glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+		slefeBoxBufferChanged = false;
+	}
+
+	// Sizes the pool's slefe boxes for the current divs and clusters, frees the whole model's, which are uploaded again
+	// when paging stops, and fills the slots of the resident clusters
+	void
+	AllocatePoolSlefeBoxes()
+	{
+		GLuint maxEdgeSides = 0;
+		for (const PatchCluster &cluster : patchClusters)
+		{
+			std::map<GLuint, GLuint> edgeSides;
+			for (GLint patchIndex : cluster.patches)
+				for (GLuint edge = 0; edge < 4; ++edge)
+					edgeSides[patchEdges[patchIndex][edge]] = patchEdgeSides[patchEdges[patchIndex][edge]].size();
+
+			GLuint numEdgeSides = 0;
+			for (auto &edge : edgeSides)
+				numEdgeSides+= edge.second;
+			maxEdgeSides = max(maxEdgeSides, numEdgeSides);
+		}
+
+		// Each side has the point boxes along it and the tile boxes between them
+		poolSlotEdgeTexels = maxEdgeSides * (2 * numSlefeDivs + 1) * slefeBoxTexels;
+
+		glBindBuffer(GL_TEXTURE_BUFFER, buffers[BUFFER_SLEFE_BOXES]);
+		glBufferData(GL_TEXTURE_BUFFER, 0, NULL, GL_STATIC_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, buffers[BUFFER_POOL_SLEFE_BOXES]);
+		glBufferData(GL_TEXTURE_BUFFER,
+		             numPoolSlots * (clusterPatches * GetPatchSlefeTexels() + poolSlotEdgeTexels) * sizeof(vec4), NULL,
+		             GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		glBindTexture(GL_TEXTURE_BUFFER, poolSlefeBoxTexture);
+		glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffers[BUFFER_POOL_SLEFE_BOXES]);
+		glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+		poolSlefeBoxesValid = true;
+		for (GLuint slot = 0; slot < numPoolSlots; ++slot)
+			if (poolClusters[slot] >= 0)
+				UploadClusterSlefeBoxes(slot);
+	}
+
+	// The slefe boxes of the cluster in a slot, with the edges' after every slot's patches
+	void
+	UploadClusterSlefeBoxes(GLint slot)
+	{
+		const PatchCluster &cluster = patchClusters[poolClusters[slot]];
+		GLuint patchStride = GetPatchSlefeTexels();
+		GLuint edgesStart = numPoolSlots * clusterPatches * patchStride + slot * poolSlotEdgeTexels;
+
+		vector<vec4> edgeTexels;
+		std::map<GLuint, std::pair<GLuint, GLuint>> edgeBoxes; // Start and count of each edge's
+		vector<vec4> patchTexels(cluster.patches.size() * patchStride);
+		for (size_t i = 0; i < cluster.patches.size(); ++i)
+		{
+			GLint patchIndex = cluster.patches[i];
+
+			GLuint edgeStarts[4], edgeBoxCounts[4];
+			for (GLuint edge = 0; edge < 4; ++edge)
+			{
+				GLuint edgeId = patchEdges[patchIndex][edge];
+				auto inserted = edgeBoxes.insert({edgeId, {edgesStart + GLuint(edgeTexels.size()), 0}});
+				if (inserted.second)
+					inserted.first->second.second = AppendEdgeSlefeBoxTexels(edgeId, edgeTexels);
+
+				edgeStarts[edge] = inserted.first->second.first;
+				edgeBoxCounts[edge] = inserted.first->second.second;
+			}
+
+			GetPatchSlefeBoxTexels(patchIndex, edgeStarts, edgeBoxCounts, &patchTexels[i * patchStride]);
+		}
+		assert(edgeTexels.size() <= poolSlotEdgeTexels);
+
+		glBindBuffer(GL_TEXTURE_BUFFER, buffers[BUFFER_POOL_SLEFE_BOXES]);
+		glBufferSubData(GL_TEXTURE_BUFFER, slot * clusterPatches * patchStride * sizeof(vec4),
+		                patchTexels.size() * sizeof(vec4), patchTexels.data());
+		glBufferSubData(GL_TEXTURE_BUFFER, edgesStart * sizeof(vec4), edgeTexels.size() * sizeof(vec4),
+		                edgeTexels.data());
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	}
+
+	void
+	SetFrameUniforms()
+	{
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+
+		frameUniforms.Set(&FrameUniforms::ModelViewMatrix, modelViewMatrix);
+		frameUniforms.Set(&FrameUniforms::ProjectionMatrix, projectionMatrix);
+		frameUniforms.Set(&FrameUniforms::LightPosition, vec3(modelViewMatrix * vec4(lightPosition, 1)));
+		frameUniforms.Set(&FrameUniforms::ViewportSize, glm::ivec2(width, height));
+		frameUniforms.Set(&FrameUniforms::QuantizedControlPoints, GLint(quantizeControlPoints));
+		frameUniforms.Bind(UNIFORM_BLOCK_FRAME);
+	}
+
+	void
+	SetTessUniforms()
+	{
+		tessUniforms.Set(&TessUniforms::NumSlefeDivs, GLint(numSlefeDivs));
+		tessUniforms.Set(&TessUniforms::FirstPatch, patchRange[0]);
+		tessUniforms.Set(&TessUniforms::PixelAccuracy, pixelAccuracy);
+		tessUniforms.Set(&TessUniforms::MysteryFactor, mysteryFactors[numSlefeDivs]);
+		tessUniforms.Bind(UNIFORM_BLOCK_TESS);
+	}
+
+	// SubLiME's bounds on the second difference terms for numSlefeDivs pieces, from the tables in SlefeTables.hh laid
+	// out as in its range files: for each of the degree - 1 terms, the upper bounds at every break point, then the
+	// lower bounds. Bezier patches get DEGREE_V's table, which Slefe.comp's first step uses, followed by DEGREE_U's.
+	// B-spline spans get bsprange's single pair, read mirrored for the span's second difference at its far end.
+	void
+	LoadSlefeTable(vector<GLfloat> &table)
+	{
+		table.clear();
+		if (model->bSpline)
+			for (GLuint bound = 0; bound < 2; ++bound)
+				for (GLuint point = 0; point <= numSlefeDivs; ++point)
+					table.push_back(cubicBSplineSlefeBounds[numSlefeDivs][bound][point]);
+		else
+			for (GLuint degree : {model->degree[1], model->degree[0]})
+				for (GLuint difference = 0; difference + 1 < degree; ++difference)
+					for (GLuint bound = 0; bound < 2; ++bound)
+						for (GLuint point = 0; point <= numSlefeDivs; ++point)
+							table.push_back(GetBezierSlefeBound(degree, numSlefeDivs, difference, bound, point));
+	}
+
+	// GPU version of ComputeSlefes() and ComputeTessLevels() with axis box enclosures, for TESS_COMPUTE. Leaves the
+	// levels in BUFFER_TESS_LEVELS, and the visible patches in BUFFER_VISIBLE_INDICES with their draw arguments in
+	// BUFFER_DRAW_COMMAND.
+	void
+	RunComputePass()
+	{
+		if (!slefeComputeProgram)
+		{
+			slefeComputeProgram = BuildComputeProgram("Slefe.comp");
+			levelComputeProgram = BuildComputeProgram("iPASS.comp");
+		}
+
+		SetFrameUniforms();
+		SetTessUniforms();
+
+		if (computedSlefeDivs != numSlefeDivs)
+		{
+			vector<GLfloat> table;
+			LoadSlefeTable(table);
+
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_SLEFE_TABLE]);
+			glBufferData(GL_SHADER_STORAGE_BUFFER, table.size() * sizeof(table[0]), table.data(), GL_STATIC_DRAW);
+		}
+
+		// Levels are maxed into the vertices, so they start out at 0 like in ComputeTessLevels()
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_TESS_LEVELS]);
+		glBufferData(GL_ARRAY_BUFFER, model->numVertices * sizeof(GLfloat), NULL, GL_STREAM_COPY);
+		glClearBufferData(GL_ARRAY_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
+
+		DrawElementsIndirectCommand command = {0, 1, 0, 0, 0};
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffers[BUFFER_DRAW_COMMAND]);
+		glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(command), &command, GL_STREAM_COPY);
+
+		static const struct {GLuint binding, buffer;} storageBuffers[] =
+		{
+			{STORAGE_CONTROL_POINTS, BUFFER_CONTROL_POINTS},
+			{STORAGE_PATCH_INDICES, BUFFER_CONTROL_POINT_INDICES},
+			{STORAGE_CONTROL_POINT_BOXES, BUFFER_CONTROL_POINT_BOXES},
+			{STORAGE_SLEFE_TABLE, BUFFER_SLEFE_TABLE},
+			{STORAGE_SLEFE_POINTS, BUFFER_SLEFE_POINTS},
+			{STORAGE_PATCH_LEVELS, BUFFER_PATCH_LEVELS},
+			{STORAGE_VERTEX_TESS_LEVELS, BUFFER_TESS_LEVELS},
+			{STORAGE_DRAW_COMMAND, BUFFER_DRAW_COMMAND},
+			{STORAGE_VISIBLE_INDICES, BUFFER_VISIBLE_INDICES}
+		};
+		for (auto &storage : storageBuffers)
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, storage.binding, buffers[storage.buffer]);
+
+		// Slefes don't depend on the view, so they're only rebuilt when the divs change
+		if (computedSlefeDivs != numSlefeDivs)
+		{
+			slefeComputeProgram->Use();
+			glDispatchCompute(model->numPatches, 1, 1);
+			glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+			computedSlefeDivs = numSlefeDivs;
+		}
+
+		levelComputeProgram->Use();
+		glDispatchCompute(patchRange[1], 1, 1);
+		glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT |
+		                GL_BUFFER_UPDATE_BARRIER_BIT);
+
+		glUseProgram(0);
+
+		CheckGLErrors("RunComputePass()");
+	}
+
+	// Compares the compute pass's results for the current view with ComputeSlefes() and ComputePatchTessLevel() with
+	// axis boxes. The compute pass works in single precision, so small differences are expected.
+	void
+	ValidateComputePass()
+	{
+		static const GLuint slefeStride = maxSlefeDivs + 1;
+		vector<vec4> points(model->numPatches * Slefe::NUM_BOUNDS * slefeStride * slefeStride);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_SLEFE_POINTS]);
+		glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, points.size() * sizeof(points[0]), points.data());
+
+		GLfloat patchLevels[maxModelPatches];
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_PATCH_LEVELS]);
+		glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(patchLevels), patchLevels);
+
+		DrawElementsIndirectCommand command;
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[BUFFER_DRAW_COMMAND]);
+		glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(command), &command);
+
+		int screenWidth, screenHeight;
+		glfwGetWindowSize(window.get(), &screenWidth, &screenHeight);
+		ComputeSlefeRects(ENCLOSURE_AXIS_BOX);
+
+		computeValidation = {};
+		computeValidation.numVisiblePatches[1] = command.count / model->GetNumPatchVertices();
+
+		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+		{
+			const vec4 *patchPoints = &points[patchIndex * Slefe::NUM_BOUNDS * slefeStride * slefeStride];
+			for (GLuint whichBounds = 0; whichBounds < Slefe::NUM_BOUNDS; ++whichBounds)
+				for (GLuint u = 0; u <= numSlefeDivs; ++u)
+					for (GLuint v = 0; v <= numSlefeDivs; ++v)
+					{
+						vec3 point = vec3(patchPoints[(whichBounds * slefeStride + u) * slefeStride + v]);
+						vec3 error = abs(point - slefes[patchIndex].bounds[whichBounds].points[u][v]);
+						computeValidation.maxPointError = max(computeValidation.maxPointError,
+						                                      max(error.x, max(error.y, error.z)));
+					}
+
+			float level = ComputePatchTessLevel(patchIndex, screenWidth, screenHeight, false);
+			computeValidation.maxLevelError = max(computeValidation.maxLevelError,
+			                                      fabsf(patchLevels[patchIndex] - level));
+			computeValidation.numVisiblePatches[0]+= (level > 0);
+			computeValidation.numVisibilityMismatches+= ((level > 0) != (patchLevels[patchIndex] > 0));
+		}
+
+		// The debug display expects the current enclosure's rects
+		ComputeSlefeRects(slefeEnclosure);
+
+		CheckGLErrors("ValidateComputePass()");
+	}
+
+	// Copies the depth buffer into BUFFER_DEPTH_READBACK without waiting for it; UpdateHiZPyramid() picks it up once
+	// the GPU is done with it, normally by the next frame
+	void
+	ReadBackDepth()
+	{
+		if (hiZReadFence)
+			return;
+
+		HiZView &view = pendingHiZView;
+		view.modelViewProjection = projectionMatrix * modelViewMatrix;
+		glfwGetWindowSize(window.get(), &view.windowWidth, &view.windowHeight);
+		glfwGetFramebufferSize(window.get(), &view.width, &view.height);
+		if (view.width <= 0 || view.height <= 0)
+			return;
+
+		// glReadPixels() can't read a multisampled buffer, so the depth goes through a single-sample copy
+		if (view.width != hiZFramebufferSize[0] || view.height != hiZFramebufferSize[1])
+		{
+			if (!hiZFramebuffer)
+			{
+				glGenFramebuffers(1, &hiZFramebuffer);
+				glGenRenderbuffers(1, &hiZRenderbuffer);
+			}
+
+			// Depth blits need matching formats, and this is the one GLFW asks for by default
+			glBindRenderbuffer(GL_RENDERBUFFER, hiZRenderbuffer);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, view.width, view.height);
+			glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+			glBindFramebuffer(GL_FRAMEBUFFER, hiZFramebuffer);
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, hiZRenderbuffer);
+			glDrawBuffer(GL_NONE);
+			glReadBuffer(GL_NONE);
+			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+				clog << "Hi-Z framebuffer incomplete" << endl;
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[BUFFER_DEPTH_READBACK]);
+			glBufferData(GL_PIXEL_PACK_BUFFER, view.width * view.height * sizeof(GLfloat), NULL, GL_STREAM_READ);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+			hiZFramebufferSize[0] = view.width;
+			hiZFramebufferSize[1] = view.height;
+		}
+
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, hiZFramebuffer);
+		glBlitFramebuffer(0, 0, view.width, view.height, 0, 0, view.width, view.height, GL_DEPTH_BUFFER_BIT,
+		                  GL_NEAREST);
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, hiZFramebuffer);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[BUFFER_DEPTH_READBACK]);
+		glReadPixels(0, 0, view.width, view.height, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		hiZReadFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	// Rebuilds hiZPyramid if the last ReadBackDepth() has finished, and keeps the old one otherwise
+	void
+	UpdateHiZPyramid()
+	{
+		if (!hiZReadFence)
+			return;
+
+		GLenum status = glClientWaitSync(hiZReadFence, 0, 0);
+		if (status == GL_TIMEOUT_EXPIRED)
+			return;
+
+		glDeleteSync(hiZReadFence);
+		hiZReadFence = 0;
+		if (status == GL_WAIT_FAILED)
+			return;
+
+		const HiZView &view = pendingHiZView;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[BUFFER_DEPTH_READBACK]);
+		const GLfloat *depths = (const GLfloat *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+		                                                          view.width * view.height * sizeof(GLfloat),
+		                                                          GL_MAP_READ_BIT);
+		if (depths)
+		{
+			BuildHiZPyramid(depths, view.width, view.height, hiZPyramid);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+			hiZView = view;
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+
+	void
+	ResetHiZPyramid()
+	{
+		if (hiZReadFence)
+			glDeleteSync(hiZReadFence);
+		hiZReadFence = 0;
+		hiZPyramid.clear();
+	}
+
+	// Whether the screen rect of the patch's control points, which bound the surface, was behind the depth in
+	// hiZPyramid. That depth is a frame or so old, so a patch that comes into view as the camera moves is only drawn
+	// once TestOccludedPatches() finds it in front of the current frame's.
+	bool
+	IsPatchOccluded(GLint patchIndex)
+	{
+		return IsBoxOccluded(hiZPyramid, hiZView, patchBounds[patchIndex]);
+	}
+
+	// Second phase of the occlusion culling: the control point boxes of the patches culled against an earlier frame's
+	// depth are tested against the current one's, with an occlusion query each, so that DrawOccludedPatches() draws
+	// the ones that have come into view since. Boxes clipped by the near plane aren't tested.
+	void
+	TestOccludedPatches()
+	{
+		mat4 modelViewProjection = projectionMatrix * modelViewMatrix;
+
+		vector<vec3> vertices;
+		vector<GLuint> indices;
+		occlusionTested.assign(occludedPatches.size(), false);
+		for (size_t i = 0; i < occludedPatches.size(); ++i)
+		{
+			vec3 boxVertices[8];
+			GetAABBVertices(patchBounds[occludedPatches[i]], boxVertices);
+
+			bool clipped = false;
+			for (GLuint corner = 0; corner < 8; ++corner)
+				clipped|= !((modelViewProjection * vec4(boxVertices[corner], 1)).w > minCameraZ);
+			if (clipped)
+				continue;
+
+			occlusionTested[i] = true;
+			AppendBoxTriangles(boxVertices, vertices, indices);
+		}
+
+		if (vertices.empty())
+			return;
+
+		debugProgram.Use();
+		Set3DCamera(debugProgram);
+
+		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_DEBUG]);
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_DEBUG_VERTICES]);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(vertices[0]), vertices.data(), GL_STREAM_DRAW);
+
+		GLint positionLocation = debugProgram.GetAttribLocation("Position");
+		glEnableVertexAttribArray(positionLocation);
+		glVertexAttribPointer(positionLocation, threeD, GL_FLOAT, GL_FALSE, 0, 0);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_DEBUG_INDICES]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(), GL_STREAM_DRAW);
+
+		// Only the depth test matters, and from inside a box only its back faces are left
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		glDepthMask(GL_FALSE);
+		glDisable(GL_CULL_FACE);
+
+		static const GLuint boxIndices = 6 * 6;
+		GLuint box = 0;
+		for (size_t i = 0; i < occludedPatches.size(); ++i)
+			if (occlusionTested[i])
+			{
+				glBeginQuery(GL_ANY_SAMPLES_PASSED, occlusionQueries[i]);
+				glDrawElements(GL_TRIANGLES, boxIndices, GL_UNSIGNED_INT, (void *)(box++ * boxIndices * sizeof(GLuint)));
+				glEndQuery(GL_ANY_SAMPLES_PASSED);
+			}
+
+		if (!twoSided)
+			glEnable(GL_CULL_FACE);
+		glDepthMask(GL_TRUE);
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+	}
+
+	// The patches TestOccludedPatches() tested, each if its query passed, which the GPU waits for rather than the CPU,
+	// and the rest. Leaves the model bound for DRAW_PATCH_LIST with the main pipeline.
+	void
+	DrawOccludedPatches(const float vertexTessLevels[maxModelVertices])
+	{
+		BindModel(vertexTessLevels);
+		mainPipeline.Bind();
+
+		for (size_t i = 0; i < occludedPatches.size(); ++i)
+		{
+			if (occlusionTested[i])
+				glBeginConditionalRender(occlusionQueries[i], GL_QUERY_WAIT);
+
+			DrawPatches(occludedPatches[i], 1);
+
+			if (occlusionTested[i])
+				glEndConditionalRender();
+		}
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_PATCH_LIST_INDICES]);
+	}
+
+	// Draw list of the patches with non-zero levels, less those cullOccludedPatches finds hidden. With sortPatches,
+	// it's nearest first by the near z of their control points' screen rect, so that early z rejects the fragments of
+	// the patches behind. Patch order doesn't matter to the per-vertex levels, unlike GPU_TESS_LEVELS, which finds a
+	// patch's slefe boxes by gl_PrimitiveID, and neither does dropping patches, whose neighbors keep their edge levels.
+	void
+	BuildPatchList(const float vertexTessLevels[maxModelVertices])
+	{
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+		vec3 halfWindowSize = vec3(width / 2.0, height / 2.0, 0.5);
+		mat4 modelViewProjection = projectionMatrix * modelViewMatrix;
+
+		if (cullOccludedPatches)
+			UpdateHiZPyramid();
+		occludedPatches.clear();
+
+		vector<std::pair<float, GLint>> patchDepths;
+		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+		{
+			// SetPatchTessLevel() gives the inner control points the patch's own level, or with B-spline spans, the
+			// largest of it and its neighbors'
+			if (!(GetPatchInnerValue(*model, vertexTessLevels, patchIndex) > 0))
+				continue;
+
+			if (cullOccludedPatches && IsPatchOccluded(patchIndex))
+			{
+				++numOccludedPatches;
+				occludedPatches.push_back(patchIndex);
+				continue;
+			}
+
+			float depth = 0;
+			if (sortPatches)
+			{
+				bool inside;
+				AABB screenRect;
+				ProjectPatchBounds(patchIndex, modelViewProjection, halfWindowSize, inside, &screenRect);
+				depth = screenRect.min.z;
+			}
+			patchDepths.emplace_back(depth, patchIndex);
+		}
+
+		if (sortPatches)
+			std::sort(patchDepths.begin(), patchDepths.end());
+
+		vector<GLuint> indices;
+		indices.reserve(patchDepths.size() * model->GetNumPatchVertices());
+		patchList.clear();
+		for (auto &patchDepth : patchDepths)
+		{
+			patchList.push_back(patchDepth.second);
+
+			// Quantized, each patch has its own copies of its control points, see QuantizeControlPoints()
+			GLuint numPatchVertices = model->GetNumPatchVertices();
+			const GLuint *patchIndices = model->GetPatchIndices(patchDepth.second);
+			for (GLuint i = 0; i < numPatchVertices; ++i)
+				indices.push_back((quantizeControlPoints) ? patchDepth.second * numPatchVertices + i : patchIndices[i]);
+		}
+
+		// Uploaded through GL_ARRAY_BUFFER, since the element array binding belongs to whichever VAO is bound
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_PATCH_LIST_INDICES]);
+		glBufferData(GL_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(), GL_STREAM_DRAW);
+
+		numPatchListIndices = indices.size();
+	}
+
+	// Binds the model's vertex arrays and per-frame uniforms for the current camera; the caller binds a pipeline.
+	// Without vertexTessLevels, the levels are the ones RunComputePass() left on the GPU in TESS_COMPUTE, and are
+	// derived from the uploaded slefe boxes by the GPU_TESS_LEVELS programs otherwise. levelBuffer is where
+	// vertexTessLevels go.
+	void
+	BindModel(const float vertexTessLevels[maxModelVertices], int drawList = DRAW_PATCH_RANGE,
+			GLuint levelBuffer = BUFFER_TESS_LEVELS)
+	{
+		bool computedLevels = (!vertexTessLevels && tessMode == TESS_COMPUTE);
+
+		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_MODEL]);
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINTS]);
+
+		static const GLuint drawListBuffers[] =
+		{
+			BUFFER_CONTROL_POINT_INDICES, // DRAW_PATCH_RANGE
+			BUFFER_PATCH_LIST_INDICES,    // DRAW_PATCH_LIST
+			BUFFER_VISIBLE_INDICES        // DRAW_INDIRECT
+		};
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[drawListBuffers[drawList]]);
+
+		glEnableVertexAttribArray(ATTRIB_POSITION);
+		SetControlPointPointer(ATTRIB_POSITION);
+
+		if (vertexTessLevels)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[levelBuffer]);
+			glBufferData(GL_ARRAY_BUFFER, model->numVertices * sizeof(vertexTessLevels[0]), vertexTessLevels,
+			             GL_STREAM_DRAW);
+
+			glEnableVertexAttribArray(ATTRIB_TESS_LEVEL);
+			glVertexAttribPointer(ATTRIB_TESS_LEVEL, 1, GL_FLOAT, GL_FALSE, 0, 0);
+		}
+		else if (computedLevels)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_TESS_LEVELS]);
+
+			glEnableVertexAttribArray(ATTRIB_TESS_LEVEL);
+			glVertexAttribPointer(ATTRIB_TESS_LEVEL, 1, GL_FLOAT, GL_FALSE, 0, 0);
+		}
+		else
+		{
+			glDisableVertexAttribArray(ATTRIB_TESS_LEVEL);
+
+			SetTessUniforms();
+
+			glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_SLEFE_BOXES);
+			glBindTexture(GL_TEXTURE_BUFFER, slefeBoxTexture);
+			glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_CHECKER);
+		}
+
+		if (quantizeControlPoints)
+			BindQuantizedControlPoints(BUFFER_CONTROL_POINT_BOXES, BUFFER_CONTROL_POINT_INDICES,
+			                           (computedLevels) ? GLuint(BUFFER_TESS_LEVELS) : levelBuffer);
+
+		SetFrameUniforms();
+	}
+
+	// Quantized, iPASS.vert decodes each patch's control points with its box, and since they're drawn as arrays, looks
+	// up the level of the shared vertex each one is a copy of
+	void
+	BindQuantizedControlPoints(GLuint boxBuffer, GLuint sharedVertexBuffer, GLuint levelBuffer)
+	{
+		static const struct {GLuint unit; GLuint PixAccCurvedSurf::*texture; GLenum format;} textures[] =
+		{
+			{TEXTURE_UNIT_CONTROL_POINT_BOXES, &PixAccCurvedSurf::controlPointBoxTexture, GL_RGB32F},
+			{TEXTURE_UNIT_SHARED_VERTICES, &PixAccCurvedSurf::sharedVertexTexture, GL_R32UI},
+			{TEXTURE_UNIT_SHARED_TESS_LEVELS, &PixAccCurvedSurf::sharedTessLevelTexture, GL_R32F}
+		};
+		GLuint textureBuffers[] = {boxBuffer, sharedVertexBuffer, levelBuffer};
+
+		for (size_t i = 0; i < sizeof(textures) / sizeof(textures[0]); ++i)
+		{
+			glActiveTexture(GL_TEXTURE0 + textures[i].unit);
+			glBindTexture(GL_TEXTURE_BUFFER, this->*textures[i].texture);
+			glTexBuffer(GL_TEXTURE_BUFFER, textures[i].format, buffers[textureBuffers[i]]);
+		}
+		glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_CHECKER);
+	}
+
+	// Quantized control points are in patch order already, see QuantizeControlPoints()
+	void
+	DrawPatches(GLint first, GLint count)
+	{
+		GLuint numPatchVertices = model->GetNumPatchVertices();
+		if (quantizeControlPoints)
+			glDrawArrays(GL_PATCHES, first * numPatchVertices, count * numPatchVertices);
+		else
+			glDrawElements(GL_PATCHES, count * numPatchVertices, GL_UNSIGNED_INT,
+			               (void *)(first * numPatchVertices * sizeof(GLuint)));
+	}
+
+	// Indirect draws take the visible patches RunComputePass() compacted into BUFFER_VISIBLE_INDICES
+	void
+	DrawModel(int drawList = DRAW_PATCH_RANGE)
+	{
+		switch (drawList)
+		{
+			case DRAW_PATCH_RANGE:
+				DrawPatches(patchRange[0], patchRange[1]);
+				break;
+
+			case DRAW_PATCH_LIST:
+				if (numPatchListIndices)
+					glDrawElements(GL_PATCHES, numPatchListIndices, GL_UNSIGNED_INT, 0);
+				break;
+
+			case DRAW_INDIRECT:
+				glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffers[BUFFER_DRAW_COMMAND]);
+				glDrawElementsIndirect(GL_PATCHES, GL_UNSIGNED_INT, 0);
+				break;
+
+			default:
+				assert(!"Invalid drawList");
+		}
+	}
+
+	// Most triangles GL can generate for the patch's levels, counting them all as the largest one times scale. Inner
+	// levels of 1 can be rounded up to 2 segments, so no fewer are counted unless the patch is culled.
+	GLuint
+	GetMaxCapturedTriangles(const CapturedPatch &patch, float scale = 1)
+	{
+		float level = max(*std::max_element(patch.outer, patch.outer + 4), max(patch.inner[0], patch.inner[1]));
+		if (!(level > 0))
+			return 0;
+
+		return EstimatePatchTriangles(max(level * scale, 2.0f), fracTessLevels);
+	}
+
+	// Captures the tessellation of the patches whose levels changed since their last capture, in model space so that
+	// it stays good from any view. When one outgrows its slot, all of the slots are laid out again with room for the
+	// levels to grow, and all of the patches are captured again.
+	void
+	CapturePatches(const float vertexTessLevels[maxModelVertices], const vector<GLint> &patches)
+	{
+		static const float slotHeadroom = 1.5;
+
+		vector<GLint> stalePatches;
+		bool layoutSlots = false;
+		for (GLint patchIndex : patches)
+		{
+			float outer[4], inner[2];
+			GetPatchTessLevels(*model, vertexTessLevels, patchIndex, outer, inner);
+
+			CapturedPatch &patch = capturedPatches[patchIndex];
+			if (patch.valid && std::equal(outer, outer + 4, patch.outer) && std::equal(inner, inner + 2, patch.inner))
+				continue;
+
+			std::copy(outer, outer + 4, patch.outer);
+			std::copy(inner, inner + 2, patch.inner);
+			patch.valid = false;
+			stalePatches.push_back(patchIndex);
+
+			layoutSlots|= (GetMaxCapturedTriangles(patch) > patch.capacity);
+		}
+
+		if (layoutSlots)
+		{
+			GLintptr offset = 0;
+			for (GLint patchIndex = 0; patchIndex < model->numPatches; ++patchIndex)
+			{
+				CapturedPatch &patch = capturedPatches[patchIndex];
+				patch.offset = offset;
+				patch.capacity = GetMaxCapturedTriangles(patch, slotHeadroom);
+				patch.valid = false;
+				offset+= patch.capacity * 3 * capturedVertexSize;
+			}
+
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CAPTURED_VERTICES]);
+			glBufferData(GL_ARRAY_BUFFER, offset, NULL, GL_DYNAMIC_COPY);
+
+			stalePatches = patches;
+			++numCaptureLayouts;
+		}
+
+		numCapturedPatches = stalePatches.size();
+		if (stalePatches.empty())
+			return;
+
+		BindModel(vertexTessLevels);
+		capturePipeline.Bind();
+		glEnable(GL_RASTERIZER_DISCARD);
+
+		for (GLint patchIndex : stalePatches)
+		{
+			CapturedPatch &patch = capturedPatches[patchIndex];
+			patch.valid = true;
+
+			// Culled, so there's nothing to capture, and DrawCapturedPatches() skips it
+			if (!patch.capacity)
+				continue;
+
+			glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, captureFeedbacks[patchIndex]);
+			glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buffers[BUFFER_CAPTURED_VERTICES], patch.offset,
+			                  patch.capacity * 3 * capturedVertexSize);
+
+			glBeginTransformFeedback(GL_TRIANGLES);
+			DrawPatches(patchIndex, 1);
+			glEndTransformFeedback();
+		}
+
+		glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+		glDisable(GL_RASTERIZER_DISCARD);
+	}
+
+	// Each patch from its own slot, with the vertex count its transform feedback object kept
+	void
+	DrawCapturedPatches(const vector<GLint> &patches)
+	{
+		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_CAPTURED]);
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CAPTURED_VERTICES]);
+
+		glEnableVertexAttribArray(REPLAY_ATTRIB_POSITION);
+		glEnableVertexAttribArray(REPLAY_ATTRIB_NORMAL);
+		glEnableVertexAttribArray(REPLAY_ATTRIB_TEX_COORD);
+
+		for (GLint patchIndex : patches)
+		{
+			const CapturedPatch &patch = capturedPatches[patchIndex];
+			if (!patch.capacity)
+				continue;
+
+			glVertexAttribPointer(REPLAY_ATTRIB_POSITION, threeD, GL_FLOAT, GL_FALSE, capturedVertexSize,
+			                      (void *)patch.offset);
+			glVertexAttribPointer(REPLAY_ATTRIB_NORMAL, threeD, GL_FLOAT, GL_FALSE, capturedVertexSize,
+			                      (void *)(patch.offset + threeD * sizeof(GLfloat)));
+			glVertexAttribPointer(REPLAY_ATTRIB_TEX_COORD, 2, GL_FLOAT, GL_FALSE, capturedVertexSize,
+			                      (void *)(patch.offset + 2 * threeD * sizeof(GLfloat)));
+
+			glDrawTransformFeedback(GL_TRIANGLES, captureFeedbacks[patchIndex]);
+		}
+	}
+
+	// Copies a cluster's control points and indices into a slot, evicting the cluster that was there, and its slefe
+	// boxes in TESS_IPASS_GPU. Otherwise, UploadSlefeBoxes() fills every slot's again once they're needed.
+	void
+	UploadCluster(GLint clusterIndex, GLint slot)
+	{
+		if (poolClusters[slot] >= 0)
+			patchClusters[poolClusters[slot]].slot = -1;
+		poolClusters[slot] = clusterIndex;
+
+		PatchCluster &cluster = patchClusters[clusterIndex];
+		cluster.slot = slot;
+
+		if (quantizeControlPoints)
+			UploadQuantizedCluster(cluster);
+		else
+		{
+			vector<GLfloat> points;
+			for (GLuint vertex : cluster.vertices)
+				points.insert(points.end(), model->vertices[vertex], model->vertices[vertex] + threeD);
+
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[BUFFER_POOL_CONTROL_POINTS]);
+			glBufferSubData(GL_COPY_WRITE_BUFFER, slot * poolSlotVertices * threeD * sizeof(GLfloat),
+			                points.size() * sizeof(GLfloat), points.data());
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[BUFFER_POOL_INDICES]);
+			glBufferSubData(GL_COPY_WRITE_BUFFER, slot * poolSlotVertices * sizeof(GLuint),
+			                cluster.indices.size() * sizeof(GLuint), cluster.indices.data());
+		}
+
+		if (tessMode == TESS_IPASS_GPU && poolSlefeBoxesValid)
+			UploadClusterSlefeBoxes(slot);
+		else
+			poolSlefeBoxesValid = false;
+	}
+
+	// Quantized, each of the cluster's patches has its own copies of its control points, which go from the slot's
+	// first patch on, like in BUFFER_CONTROL_POINTS, so that iPASS.vert finds their box by vertex. In place of
+	// indices, BUFFER_POOL_INDICES has the pool vertex of each copy, whose level BindPooledClusters() sets.
+	void
+	UploadQuantizedCluster(const PatchCluster &cluster)
+	{
+		GLuint numPatchVertices = model->GetNumPatchVertices();
+		GLuint firstPatch = cluster.slot * clusterPatches;
+
+		vector<GLushort> points;
+		vector<ControlPointBox> boxes;
+		for (GLint patchIndex : cluster.patches)
+		{
+			const GLushort *patchPoints = &quantizedVertices[patchIndex * numPatchVertices * threeD];
+			points.insert(points.end(), patchPoints, patchPoints + numPatchVertices * threeD);
+			boxes.push_back(controlPointBoxes[patchIndex]);
+		}
+
+		vector<GLuint> sharedVertices;
+		for (GLuint index : cluster.indices)
+			sharedVertices.push_back(cluster.slot * poolSlotVertices + index);
+
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[BUFFER_POOL_CONTROL_POINTS]);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, firstPatch * numPatchVertices * threeD * sizeof(GLushort),
+		                points.size() * sizeof(GLushort), points.data());
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[BUFFER_POOL_CONTROL_POINT_BOXES]);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, firstPatch * sizeof(ControlPointBox), boxes.size() * sizeof(boxes[0]),
+		                boxes.data());
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[BUFFER_POOL_INDICES]);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, firstPatch * numPatchVertices * sizeof(GLuint),
+		                sharedVertices.size() * sizeof(GLuint), sharedVertices.data());
+	}
+
+	// Finds the clusters whose bounds are in view, with the projection of ComputeSlefeRect() onto the framebuffer, so
+	// that the sizes are in the pixels that are drawn, and makes them resident on the GPU, the largest on screen first
+	// and at most maxClusterUploads of them a frame. Each takes an empty slot, or the one drawn longest ago. The
+	// visible clusters that are resident go in drawnClusters.
+	void
+	PageInClusters(vector<GLint> &drawnClusters)
+	{
+		int width, height;
+		glfwGetFramebufferSize(window.get(), &width, &height);
+		vec3 halfWindowSize = vec3(width / 2.0, height / 2.0, 0.5);
+		mat4 modelViewProjection = projectionMatrix * modelViewMatrix;
+
+		++poolFrame;
+
+		vector<std::pair<float, GLint>> requests; // Longest screen edge and cluster
+		FindVisibleClusters(patchClusters, modelViewProjection, halfWindowSize, requests);
+
+		poolStats = {};
+		poolStats.numVisible = requests.size();
+		for (auto &request : requests)
+		{
+			PatchCluster &cluster = patchClusters[request.second];
+			if (cluster.slot < 0 && poolStats.numUploaded < maxClusterUploads)
+			{
+				// Slots drawn this frame went to larger clusters
+				GLint slot = SelectPoolSlot(patchClusters, poolClusters, poolFrame);
+				if (slot >= 0)
+				{
+					UploadCluster(request.second, slot);
+					++poolStats.numUploaded;
+				}
+			}
+
+			if (cluster.slot >= 0)
+			{
+				cluster.lastDrawn = poolFrame;
+				drawnClusters.push_back(request.second);
+			}
+			else
+				++poolStats.numMissing;
+		}
+
+		poolStats.numResident = numPoolSlots - std::count(poolClusters.begin(), poolClusters.end(), -1);
+	}
+
+	// Like BindModel() for the pool, with the clusters' levels gathered into their slots, or without vertexTessLevels,
+	// derived from the pool's slefe boxes by the GPU_TESS_LEVELS programs
+	void
+	BindPooledClusters(const float vertexTessLevels[maxModelVertices], const vector<GLint> &clusters)
+	{
+		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_POOL]);
+
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_POOL_INDICES]);
+
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_POOL_CONTROL_POINTS]);
+		glEnableVertexAttribArray(ATTRIB_POSITION);
+		SetControlPointPointer(ATTRIB_POSITION);
+
+		if (vertexTessLevels)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_POOL_TESS_LEVELS]);
+			vector<GLfloat> levels;
+			for (GLint clusterIndex : clusters)
+			{
+				const PatchCluster &cluster = patchClusters[clusterIndex];
+
+				levels.clear();
+				for (GLuint vertex : cluster.vertices)
+					levels.push_back(vertexTessLevels[vertex]);
+				glBufferSubData(GL_ARRAY_BUFFER, cluster.slot * poolSlotVertices * sizeof(GLfloat),
+				                levels.size() * sizeof(GLfloat), levels.data());
+			}
+
+			glEnableVertexAttribArray(ATTRIB_TESS_LEVEL);
+			glVertexAttribPointer(ATTRIB_TESS_LEVEL, 1, GL_FLOAT, GL_FALSE, 0, 0);
+		}
+		else
+		{
+			assert(poolSlefeBoxesValid);
+			glDisableVertexAttribArray(ATTRIB_TESS_LEVEL);
 
-							for (GLuint whichBounds = 0; whichBounds < Slefe::NUM_BOUNDS; ++whichBounds)
-							{
-								tileBox.worldAxisBox.max = max(tileBox.worldAxisBox.max, midPoints[whichBounds]);
-								tileBox.worldAxisBox.min = min(tileBox.worldAxisBox.min, midPoints[whichBounds]);
-							}
-						}
+			SetTessUniforms();
 
-						GetAABBVertices(tileBox.worldAxisBox, tileBoxVertices[patchIndex][u][v]);
-					}
-				}
+			glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_SLEFE_BOXES);
+			glBindTexture(GL_TEXTURE_BUFFER, poolSlefeBoxTexture);
+			glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT_CHECKER);
 		}
 
-		slefeBoxesChanged = false;
-		slefeTilesChanged = true;
+		if (quantizeControlPoints)
+			BindQuantizedControlPoints(BUFFER_POOL_CONTROL_POINT_BOXES, BUFFER_POOL_INDICES, BUFFER_POOL_TESS_LEVELS);
+
+		SetFrameUniforms();
 	}
 
+	// With the GPU levels, FirstPatch points iPASS.tesc at the slot's slefe boxes
 	void
-	ComputeSlefeRect(SlefeBox &box, vec3 (&worldBoxVertices)[8], const vec3 &halfWindowSize)
+	DrawPooledClusters(const vector<GLint> &clusters, bool gpuLevels)
 	{
-		vec3 &screenMin = box.screenAxisBox.min;
-		vec3 &screenMax = box.screenAxisBox.max;
-
-		screenMin = vec3(INFINITY);
-		screenMax = vec3(-INFINITY);
-
-		for (GLuint i = 0; i < 8; ++i)
+		for (GLint clusterIndex : clusters)
 		{
-			vec4 worldVertex = vec4(worldBoxVertices[i], 1);
-			vec4 clipVertex = projectionMatrix * modelViewMatrix * worldVertex;
-			vec3 normVertex = vec3(clipVertex[0], clipVertex[1], clipVertex[2]) / vec3(clipVertex.w);
-			vec3 winVertex = halfWindowSize + normVertex * halfWindowSize;
-
-			for (GLuint dim = 0; dim < threeD; ++dim)
+			const PatchCluster &cluster = patchClusters[clusterIndex];
+			if (gpuLevels)
 			{
-				screenMin[dim] = min(screenMin[dim], winVertex[dim]);
-				screenMax[dim] = max(screenMax[dim], winVertex[dim]);
+				tessUniforms.Set(&TessUniforms::FirstPatch, GLint(cluster.slot * clusterPatches));
+				tessUniforms.Bind(UNIFORM_BLOCK_TESS);
 			}
-		}
 
-		box.maxScreenEdge = max(screenMax.x - screenMin.x, screenMax.y - screenMin.y);
+			// Quantized, the patches' copies of their control points, see UploadQuantizedCluster()
+			if (quantizeControlPoints)
+				glDrawArrays(GL_PATCHES, cluster.slot * clusterPatches * model->GetNumPatchVertices(),
+				             cluster.indices.size());
+			else
+				glDrawElementsBaseVertex(GL_PATCHES, cluster.indices.size(), GL_UNSIGNED_INT,
+				                         (void *)(cluster.slot * poolSlotVertices * sizeof(GLuint)),
+				                         cluster.slot * poolSlotVertices);
+		}
 	}
 
+	// Depth of the patches tessellated at the slefe breakpoints and pushed back by their slefe width, which bounds the
+	// distance from those triangles to the surface, and by a slope-scaled polygon offset for the pixels they cover off
+	// the surface, so the shaded pass can run with GL_LEQUAL and shade about one fragment per pixel. The polygon offset
+	// is a heuristic, so this isn't conservative: chord triangles that stick out past a silhouette in front of geometry
+	// much farther back can hide some of it. That's why depthPrepass is off by default and labelled so in RenderUI().
 	void
-	ComputeSlefeRects()
+	RenderDepthPrepass(int drawList)
 	{
-		ComputeSlefeBoxes();
+		ComputeSlefes();
 
-		int width, height;
-		glfwGetWindowSize(window.get(), &width, &height);
-		vec3 halfWindowSize = vec3(width / 2.0, height / 2.0, 0.5);
+		// In eye space, where iPASS.tese applies the offset
+		float eyeScale = 0;
+		for (GLuint axis = 0; axis < threeD; ++axis)
+			eyeScale = max(eyeScale, length(vec3(modelViewMatrix[axis])));
 
+		// Carried by the tess level attribute, at the patch's inner control points
+		float vertexDepthOffsets[maxModelVertices] = {};
+		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+			SetPatchInnerValue(*model, vertexDepthOffsets, patchIndex, slefeWidths[patchIndex] * eyeScale);
+
+		// The triangles can cover pixels up to the slefe width away from the ones the surface covers, where the depth
+		// of a steep triangle, near a silhouette or at a grazing angle, can be ahead of the surface's by its slope times
+		// that many pixels. The width is largest in pixels at the patch bounds' nearest corner.
+		int framebufferWidth, framebufferHeight;
+		glfwGetFramebufferSize(window.get(), &framebufferWidth, &framebufferHeight);
+		bool orthographic = (projectionMatrix[2][3] == 0);
+		float maxWidthPixels = 0;
 		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
 		{
-			SlefeBox (&pointBoxes)[maxSlefeDivs + 1][maxSlefeDivs + 1] = pointSlefeBoxes[patchIndex];
-			auto &tileBoxes = tileSlefeBoxes[patchIndex];
+			vec3 vertices[8];
+			GetAABBVertices(patchBounds[patchIndex], vertices);
 
-			for (GLuint u = 0; u <= numSlefeDivs; ++u)
-				for (GLuint v = 0; v <= numSlefeDivs; ++v)
-				{
-					ComputeSlefeRect(pointBoxes[u][v], pointBoxVertices[patchIndex][u][v], halfWindowSize);
+			float nearestZ = maxCameraZ;
+			for (GLuint i = 0; i < 8; ++i)
+				nearestZ = min(nearestZ, -(modelViewMatrix * vec4(vertices[i], 1)).z);
 
-					if (u < numSlefeDivs && v < numSlefeDivs)
-						ComputeSlefeRect(tileBoxes[u][v], tileBoxVertices[patchIndex][u][v], halfWindowSize);
-				}
+			float pixelsPerUnit = projectionMatrix[1][1] * framebufferHeight / 2;
+			if (!orthographic)
+				pixelsPerUnit/= max(nearestZ, minCameraZ);
+			maxWidthPixels = max(maxWidthPixels, slefeWidths[patchIndex] * eyeScale * pixelsPerUnit);
 		}
-	}
 
-	void
-	RenderModel(const float vertexTessLevels[NumTeapotPatches])
-	{
-		glBindVertexArray(vertexArrayObjects[VERTEX_ARRAY_TEAPOT]);
+		BindModel(vertexDepthOffsets, drawList, BUFFER_DEPTH_OFFSETS);
+		SetTessUniforms();
 
-		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINTS]);
-		//glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[BUFFER_CONTROL_POINT_INDICES]);
+		depthPrepassPipeline.Bind();
+
+		if (!twoSided)
+			glEnable(GL_CULL_FACE);
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		glEnable(GL_POLYGON_OFFSET_FILL);
+		glPolygonOffset(ceilf(maxWidthPixels) + 1, 1);
 
-		mainProgram->Use();
+		DrawModel(drawList);
 
-		GLint positionLocation = mainProgram->GetAttribLocation("Position");
-		glEnableVertexAttribArray(positionLocation);
-		glVertexAttribPointer(positionLocation, threeD, GL_FLOAT, GL_FALSE, 0, 0);
+		glDisable(GL_POLYGON_OFFSET_FILL);
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+		if (!twoSided)
+			glDisable(GL_CULL_FACE);
+	}
 
-		glBindBuffer(GL_ARRAY_BUFFER, buffers[BUFFER_TESS_LEVELS]);
-		glBufferData(GL_ARRAY_BUFFER, NumTeapotVertices * sizeof(vertexTessLevels[0]), vertexTessLevels, GL_STREAM_DRAW);
+	void
+	RenderModel(const float vertexTessLevels[maxModelVertices])
+	{
+		// Clusters are paged in by the view, and the whole model isn't on the GPU, so everything that draws from it is
+		// off: the patch lists, the pre-pass and the captures here, and TESS_COMPUTE, which RenderUI() doesn't offer
+		bool paged = pageClusters;
+		assert(!paged || tessMode != TESS_COMPUTE);
+		vector<GLint> pooledClusters;
+
+		int drawList = DRAW_PATCH_RANGE;
+		numOccludedPatches = 0;
+		if (!vertexTessLevels && tessMode == TESS_COMPUTE)
+			drawList = DRAW_INDIRECT;
+		else if (vertexTessLevels && (sortPatches || cullOccludedPatches) && !paged)
+		{
+			drawList = DRAW_PATCH_LIST;
+			BuildPatchList(vertexTessLevels);
+		}
 
-		GLint tessLevelLocation = mainProgram->GetAttribLocation("TessLevel");
-		glEnableVertexAttribArray(tessLevelLocation);
-		glVertexAttribPointer(tessLevelLocation, 1, GL_FLOAT, GL_FALSE, 0, 0);
+		bool prepass = (depthPrepass && showModel && !paged);
+		if (prepass)
+			RenderDepthPrepass(drawList);
 
-		Set3DCamera(*mainProgram);
+		// Which captures are still good is only known with CPU levels, and the parametric error needs the patches
+		bool replay = (cacheTessellation && vertexTessLevels && !showError && !paged);
+		vector<GLint> replayedPatches;
+		if (replay && drawList == DRAW_PATCH_LIST)
+			replayedPatches = patchList;
+		else if (replay)
+			for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+				replayedPatches.push_back(patchIndex);
 
-		if (!twoSided)
-			glEnable(GL_CULL_FACE);
+		auto draw = [&]()
+		{
+			if (paged)
+				DrawPooledClusters(pooledClusters, !vertexTessLevels);
+			else if (replay)
+				DrawCapturedPatches(replayedPatches);
+			else
+				DrawModel(drawList);
+		};
 
-		if (showError)
+		// The patches culled against an earlier frame's depth that this frame's shows, after all of the others
+		bool retestOccluded = (drawList == DRAW_PATCH_LIST && !occludedPatches.empty());
+		auto drawOccluded = [&]()
 		{
-			int width, height;
-			glfwGetWindowSize(window.get(), &width, &height);
-			glm::ivec2 viewportSize = glm::ivec2(width, height);
-			mainProgram->SetUniform("ViewportSize", viewportSize);
+			DrawOccludedPatches(vertexTessLevels);
+			if (replay)
+				replayPipeline.Bind();
+		};
+
+		if (paged)
+		{
+			PageInClusters(pooledClusters);
+			BindPooledClusters(vertexTessLevels, pooledClusters);
+			mainPipeline.Bind();
+		}
+		else if (replay)
+		{
+			CapturePatches(vertexTessLevels, replayedPatches);
+
+			SetFrameUniforms();
+			replayPipeline.Bind();
 		}
-		else if (showNormals)
-			;
 		else
 		{
-			mainProgram->SetUniform("AmbientIntensity", ambientIntensity);
-			mainProgram->SetUniform("TextureRepeat", textureRepeat);
-			vec3 worldLightPos = vec3(modelViewMatrix * vec4(lightPosition, 1));
-			mainProgram->SetUniform("LightPosition", worldLightPos);
-			mainProgram->SetUniform("LightIntensity", lightIntensity);
-			mainProgram->SetUniform("Shininess", shininess);
+			BindModel(vertexTessLevels, drawList);
+			mainPipeline.Bind();
 		}
 
+		materialUniforms.Set(&MaterialUniforms::AmbientIntensity, ambientIntensity);
+		materialUniforms.Set(&MaterialUniforms::LightIntensity, lightIntensity);
+		materialUniforms.Set(&MaterialUniforms::Shininess, shininess);
+		materialUniforms.Set(&MaterialUniforms::TextureRepeat, textureRepeat);
+		materialUniforms.Set(&MaterialUniforms::DiffuseColor1, diffuseColor1);
+		materialUniforms.Set(&MaterialUniforms::DiffuseColor2, (useTexture) ? diffuseColor2 : diffuseColor1);
+		materialUniforms.Bind(UNIFORM_BLOCK_MATERIAL);
+
+		if (!twoSided)
+			glEnable(GL_CULL_FACE);
+		if (prepass)
+			glDepthFunc(GL_LEQUAL);
+
 		if (showModel)
 		{
 			if (showStatsCounters)
@@ -1035,18 +3448,22 @@ public:
 			}
 
 			for (GLuint i = 0; i < copies; ++i)
-			{
-				glDrawElements(GL_PATCHES,
-				               NumTeapotVerticesPerPatch * patchRange[1],
-				               GL_UNSIGNED_INT, (void *)(patchRange[0] * sizeof(TeapotIndices[0])));
-			}
+				draw();
 
 			if (showStatsCounters)
 			{
 				glEndQuery(GL_PRIMITIVES_GENERATED);
 				glEndQuery(GL_SAMPLES_PASSED);
 			}
+
+			if (retestOccluded)
+			{
+				TestOccludedPatches();
+				drawOccluded();
+			}
 		}
+		else if (retestOccluded)
+			occlusionTested.assign(occludedPatches.size(), false);
 
 		if (showWireframe)
 		{
@@ -1060,9 +3477,9 @@ public:
 
 			glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
-			glDrawElements(GL_PATCHES,
-			               NumTeapotVerticesPerPatch * patchRange[1],
-			               GL_UNSIGNED_INT, (void *)(patchRange[0] * sizeof(TeapotIndices[0])));
+			draw();
+			if (retestOccluded)
+				drawOccluded();
 
 			glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
 
@@ -1076,18 +3493,313 @@ public:
 
 		if (!twoSided)
 			glDisable(GL_CULL_FACE);
+		glDepthFunc(GL_LESS);
 
 		glBindVertexArray(0);
 	}
 
+	// Orbits the model at a random angle and distance, within the range of the camera animation
+	void
+	SetRandomView(std::mt19937 &random)
+	{
+		modelViewMatrix = GetRandomView(random, modelCentroid);
+	}
+
+	void
+	ComputeViewTessLevels(float vertexTessLevels[maxModelVertices], int screenWidth, int screenHeight)
+	{
+		for (GLuint i = 0; i < model->numVertices; ++i)
+			vertexTessLevels[i] = 0;
+
+		for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+			SetPatchTessLevel(*model, vertexTessLevels, patchIndex,
+			                  ComputePatchTessLevel(patchIndex, screenWidth, screenHeight, false));
+	}
+
+	// Largest distance in pixels between the tessellated and the limit surface, using the same per-fragment comparison
+	// as Debug.frag's SHOW_ERROR path. Expects the float error target to be bound with max blending.
+	float
+	MeasurePixelError(const float vertexTessLevels[maxModelVertices], int width, int height, vector<GLfloat> &errors)
+	{
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		BindModel(vertexTessLevels);
+		DrawModel();
+		glBindVertexArray(0);
+
+		glReadPixels(0, 0, width, height, GL_RED, GL_FLOAT, errors.data());
+
+		return *std::max_element(errors.begin(), errors.end());
+	}
+
+	// Fits mysteryFactors[numSlefeDivs] to the smallest factor that keeps the measured error of the current patch range
+	// within pixelAccuracy over numCalibrationViews random views
+	void
+	CalibrateMysteryFactor(int width, int height, vector<GLfloat> &errors)
+	{
+		float &factor = mysteryFactors[numSlefeDivs];
+		float fittedFactor = minMysteryFactor;
+		numSaturatedViews[numSlefeDivs] = 0;
+
+		// Same views every time, so the factors for different divs are comparable
+		std::mt19937 random(1);
+
+		float vertexTessLevels[maxModelVertices];
+		for (GLuint view = 0; view < numCalibrationViews; ++view)
+		{
+			SetRandomView(random);
+
+			// Only the levels depend on the factor, so the rects are computed once per view
+			ComputeSlefeRects(slefeEnclosure);
+
+			bool saturated;
+			fittedFactor = FitMysteryFactor(fittedFactor, pixelAccuracy, [&](float viewFactor)
+			{
+				factor = viewFactor;
+				ComputeViewTessLevels(vertexTessLevels, width, height);
+				return MeasurePixelError(vertexTessLevels, width, height, errors);
+			}, saturated);
+			numSaturatedViews[numSlefeDivs]+= saturated;
+		}
+
+		factor = fittedFactor;
+	}
+
+	// Fits the mystery factor for the current divs, or for all of them, with the current enclosure, accuracy and spacing
+	void
+	CalibrateMysteryFactors(bool allDivs)
+	{
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+
+		GLuint errorRenderbuffer;
+		glGenRenderbuffers(1, &errorRenderbuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, errorRenderbuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_R32F, width, height);
+
+		GLuint errorFramebuffer;
+		glGenFramebuffers(1, &errorFramebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, errorFramebuffer);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, errorRenderbuffer);
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE)
+		{
+			ProgramPipeline errorPipeline;
+			errorPipeline.UseStages(*GetStageProgram(bezierPatchMethod, SHOW_ERROR_COLORED, false, fracTessLevels, false,
+			                                         *model, true));
+			errorPipeline.UseStages(*GetStageProgram(bezierPatchMethod, SHOW_ERROR_RAW, false, fracTessLevels, false,
+			                                         *model, false));
+			errorPipeline.Bind();
+
+			// Every fragment counts, including hidden and back-facing ones, and each pixel keeps its largest error
+			glViewport(0, 0, width, height);
+			glDisable(GL_DEPTH_TEST);
+			glEnable(GL_BLEND);
+			glBlendEquation(GL_MAX);
+			glClearColor(0, 0, 0, 0);
+			glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+			mat4 savedModelViewMatrix = modelViewMatrix;
+			GLuint savedSlefeDivs = numSlefeDivs;
+			vector<GLfloat> errors(width * height);
+
+			for (GLuint divs = 2; divs <= maxSlefeDivs; ++divs)
+			{
+				if (!allDivs && divs != savedSlefeDivs)
+					continue;
+
+				if (divs != numSlefeDivs)
+				{
+					numSlefeDivs = divs;
+					slefesChanged = true;
+				}
+
+				CalibrateMysteryFactor(width, height, errors);
+			}
+
+			if (numSlefeDivs != savedSlefeDivs)
+			{
+				numSlefeDivs = savedSlefeDivs;
+				slefesChanged = true;
+			}
+			modelViewMatrix = savedModelViewMatrix;
+
+			glBlendEquation(GL_FUNC_ADD);
+			glDisable(GL_BLEND);
+			glEnable(GL_DEPTH_TEST);
+		}
+		else
+			clog << "Calibration framebuffer incomplete" << endl;
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glDeleteFramebuffers(1, &errorFramebuffer);
+		glDeleteRenderbuffers(1, &errorRenderbuffer);
+
+		int framebufferWidth, framebufferHeight;
+		glfwGetFramebufferSize(window.get(), &framebufferWidth, &framebufferHeight);
+		glViewport(0, 0, framebufferWidth, framebufferHeight);
+
+		CheckGLErrors("CalibrateMysteryFactors()");
+	}
+
+	// Tessellates the patch range on the CPU like the GPU would for the current view, measuring the triangles and the
+	// screen-space error of each patch
+	TessError
+	MeasureReferenceView(const float vertexTessLevels[maxModelVertices], TessError patchErrors[maxModelPatches])
+	{
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+
+		TessSpacing spacing = (fracTessLevels) ? TESS_FRACTIONAL_EVEN_SPACING : TESS_EQUAL_SPACING;
+
+		return MeasureReferenceError(*model, vertexTessLevels, patchRange[0], patchRange[1], spacing,
+		                             projectionMatrix * modelViewMatrix, vec2(width, height), referencePercentile,
+		                             patchErrors);
+	}
+
+	// Measures numReferenceViews random views with the current tessellation settings, logging one line per view so
+	// the accuracy and triangle counts of different settings can be compared offline
+	void
+	SweepReferenceViews()
+	{
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+
+		mat4 savedModelViewMatrix = modelViewMatrix;
+		std::mt19937 random(1);
+		float vertexTessLevels[maxModelVertices];
+		TessError patchErrors[maxModelPatches];
+
+		referenceError = {};
+		clog << "view,triangles,max error,p" << referencePercentile << " error" << endl;
+
+		for (GLuint view = 0; view < numReferenceViews; ++view)
+		{
+			SetRandomView(random);
+
+			if (tessMode != TESS_UNIFORM)
+			{
+				ComputeSlefeRects(slefeEnclosure);
+				ComputeViewTessLevels(vertexTessLevels, width, height);
+			}
+			else
+				std::fill(vertexTessLevels, vertexTessLevels + model->numVertices, uniformLevel);
+
+			TessError viewError = MeasureReferenceView(vertexTessLevels, patchErrors);
+			AccumulateTessError(referenceError, viewError);
+
+			clog << view << ',' << viewError.numTriangles << ',' << viewError.maxError << ','
+			     << viewError.percentileError << endl;
+		}
+
+		modelViewMatrix = savedModelViewMatrix;
+
+		// Leave the screen rects of the actual view for the debug display
+		if (tessMode != TESS_UNIFORM)
+			ComputeSlefeRects(slefeEnclosure);
+	}
+
+	// Measures the current view with the levels from each enclosure, so that their triangle counts are compared along
+	// with the error they actually reach, rather than assumed to be at the same pixel accuracy
+	void
+	CompareEnclosures()
+	{
+		int width, height;
+		glfwGetWindowSize(window.get(), &width, &height);
+
+		float vertexTessLevels[maxModelVertices];
+		TessError patchErrors[maxModelPatches];
+		for (int enclosure = 0; enclosure < NUM_ENCLOSURES; ++enclosure)
+		{
+			ComputeSlefeRects(enclosure);
+			ComputeViewTessLevels(vertexTessLevels, width, height);
+			enclosureErrors[enclosure] = MeasureReferenceView(vertexTessLevels, patchErrors);
+		}
+
+		// Leave the screen rects of the current enclosure for the debug display
+		ComputeSlefeRects(slefeEnclosure);
+	}
+
+	void
+	RenderReferenceUI()
+	{
+		if (!ImGui::TreeNode("CPU reference"))
+			return;
+
+		if (ImGui::Button("Measure view"))
+			referenceRequest = REFERENCE_VIEW;
+		ImGui::SameLine();
+		if (ImGui::Button("Sweep views"))
+			referenceRequest = REFERENCE_SWEEP;
+
+		static const GLuint step = 100;
+		ImGui::InputScalar("Views", ImGuiDataType_U32, &numReferenceViews, &step);
+		ImGui::DragFloat("Percentile", &referencePercentile, 0.1, 0, 100, "%.1f");
+
+		ImGui::Text("%'u triangles, %.3f max, %.3f p%.0f pixels error", referenceError.numTriangles,
+		            referenceError.maxError, referenceError.percentileError, referencePercentile);
+
+		if (tessMode != TESS_UNIFORM)
+		{
+			if (ImGui::Button("Compare enclosures"))
+				referenceRequest = REFERENCE_ENCLOSURES;
+			for (int enclosure = 0; enclosure < NUM_ENCLOSURES; ++enclosure)
+			{
+				const TessError &error = enclosureErrors[enclosure];
+				ImGui::Text("%s: %'u triangles, %.3f max, %.3f p%.0f pixels error", enclosureNames[enclosure],
+				            error.numTriangles, error.maxError, error.percentileError, referencePercentile);
+			}
+		}
+
+		if (ImGui::TreeNode("Patches"))
+		{
+			for (GLint patchIndex = patchRange[0]; patchIndex < patchRange[0] + patchRange[1]; ++patchIndex)
+			{
+				const TessError &error = referencePatchErrors[patchIndex];
+				ImGui::Text("Patch %i: %'u triangles, %.3f max, %.3f p%.0f", patchIndex, error.numTriangles,
+				            error.maxError, error.percentileError, referencePercentile);
+			}
+			ImGui::TreePop();
+		}
+
+		ImGui::TreePop();
+	}
+
+	// Greyed out and left as it is when it doesn't apply, rather than hidden, so it's clear what's off and why
+	static bool
+	CheckboxIf(bool enabled, const char *label, bool *value)
+	{
+		if (enabled)
+			return ImGui::Checkbox(label, value);
+
+		bool shown = *value;
+		ImGui::PushStyleVar(ImGuiStyleVar_Alpha, ImGui::GetStyle().Alpha * 0.5f);
+		ImGui::Checkbox(label, &shown);
+		ImGui::PopStyleVar();
+		return false;
+	}
+
+	static bool
+	ButtonIf(bool enabled, const char *label)
+	{
+		ImGui::PushStyleVar(ImGuiStyleVar_Alpha, ImGui::GetStyle().Alpha * ((enabled) ? 1.0f : 0.5f));
+		bool pressed = ImGui::Button(label);
+		ImGui::PopStyleVar();
+		return pressed && enabled;
+	}
+
 	void
 	RenderUI(double time)
 	{
 		ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_FirstUseEver);
 		ImWindow gui("Controls", NULL, ImGuiWindowFlags_AlwaysAutoResize);
 
-		ImGui::Combo("Mode", &tessMode, "iPASS\0Uniform\0\0");
-		if (tessMode == TESS_IPASS)
+		if (ImGui::Combo("Model", &modelIndex, modelNames, NUM_MODELS))
+			LoadModel(modelIndex);
+		if (ImGui::Combo("Mode", &tessMode, tessModeNames,
+				(computeSupported && !pageClusters) ? NUM_TESS_MODES : TESS_COMPUTE))
+			RebuildMainProgram();
+		if (tessMode != TESS_UNIFORM)
 		{
 			if (ImGui::CollapsingHeader("iPASS", ImGuiTreeNodeFlags_DefaultOpen))
 			{
@@ -1097,6 +3809,29 @@ public:
 					numSlefeDivs = glm::clamp(numSlefeDivs, 2u, maxSlefeDivs);
 					slefesChanged = true;
 				}
+				if (tessMode == TESS_IPASS)
+				{
+					ImGui::SameLine();
+					if (ImGui::Checkbox("Per patch", &adaptiveSlefeDivs))
+						tessLevelCacheValid = false;
+					if (adaptiveSlefeDivs)
+					{
+						if (ImGui::DragFloat("Div size", &slefeDivPixels, 1, 8, 512, "%.0f pixels"))
+						{
+							slefeDivPixels = glm::clamp(slefeDivPixels, 8.0f, 512.0f);
+							tessLevelCacheValid = false;
+						}
+						ImGui::Text("%u to %u divs", adaptiveDivsRange[0], adaptiveDivsRange[1]);
+					}
+				}
+				if (ImGui::Checkbox("Single precision slefes", &singlePrecisionSlefes))
+				{
+					slefesChanged = true;
+					for (auto &patchCaches : patchSlefeCaches)
+						for (auto &cache : patchCaches)
+							cache.reset();
+					tessLevelCacheValid = false;
+				}
 
 				if (ImGui::DragFloat("Pix acc.", &pixelAccuracy, 0.01, 0.01, 10.0, "%.2f pixels"))
 					pixelAccuracy = glm::clamp(pixelAccuracy, 0.01f, 10.0f);
@@ -1104,15 +3839,78 @@ public:
 				if (ImGui::Checkbox("Fractional tessellation", &fracTessLevels))
 					RebuildMainProgram();
 
+				if (tessMode == TESS_IPASS && adaptiveSlefeDivs)
+				{
+					// Only the axis boxes are kept per div count
+					slefeEnclosure = ENCLOSURE_AXIS_BOX;
+					ImGui::Text("Enclosure: %s", enclosureNames[ENCLOSURE_AXIS_BOX]);
+				}
+				else if (tessMode == TESS_COMPUTE)
+				{
+					ImGui::Text("Enclosure: %s", enclosureNames[ENCLOSURE_AXIS_BOX]);
+
+					if (ImGui::Button("Validate against CPU"))
+						validateComputeRequest = true;
+					ImGui::Text("Max slefe point error %g, max level error %g", computeValidation.maxPointError,
+					            computeValidation.maxLevelError);
+					ImGui::Text("%u CPU, %u GPU visible patches, %u mismatched",
+					            computeValidation.numVisiblePatches[0], computeValidation.numVisiblePatches[1],
+					            computeValidation.numVisibilityMismatches);
+				}
+				else if (ImGui::Combo("Enclosure", &slefeEnclosure, enclosureNames, NUM_ENCLOSURES))
+					slefeBoxBufferChanged = true;
+
+				if (tessMode == TESS_IPASS)
+				{
+					ImGui::Checkbox("Reuse levels", &cacheTessLevels);
+					if (cacheTessLevels)
+					{
+						ImGui::SameLine();
+						ImGui::Text("%u of %d patches recomputed", numRecomputedPatches, patchRange[1]);
+						ImGui::SliderFloat("Hysteresis", &levelHysteresis, 0, 0.5, "%.2f");
+					}
+				}
+				ImGui::Text("%'u est. triangles", estimatedTriangles[slefeEnclosure]);
+
+				// It measures the whole model, which isn't on the GPU while paging
+				if (ButtonIf(!pageClusters, "Calibrate"))
+					calibrationRequest = CALIBRATE_DIVS;
+				ImGui::SameLine();
+				if (ButtonIf(!pageClusters, "Calibrate all divs"))
+					calibrationRequest = CALIBRATE_ALL_DIVS;
+				ImGui::SameLine();
+				ImGui::Text("Factor %.3f", mysteryFactors[numSlefeDivs]);
+				if (showDebugWindow)
+				{
+					static const GLuint step = 8;
+					ImGui::InputScalar("Calibration views", ImGuiDataType_U32, &numCalibrationViews, &step);
+				}
+				if (numSaturatedViews[numSlefeDivs])
+					ImGui::Text("%u of %u views need levels above %u", numSaturatedViews[numSlefeDivs],
+					            numCalibrationViews, maxTessGenLevel);
+
 				ImGui::Checkbox("Show slefe boxes", &showSlefeBoxes);
 				ImGui::Checkbox("Show screen-space slefe bounds", &showScreenRects);
 				ImGui::Checkbox("Show slefe tiles", &showSlefeTiles);
+
+				if (ImGui::Button("Benchmark slefe kernels"))
+					BenchmarkSlefeKernels();
+				if (slefeBenchmark.divs)
+				{
+					ImGui::SameLine();
+					ImGui::Text("%u divs: %.2f us/patch SubLiME, %.2f us/patch kernels, max difference %g",
+					            slefeBenchmark.divs, slefeBenchmark.libraryMicroseconds, slefeBenchmark.kernelMicroseconds,
+					            slefeBenchmark.maxDifference);
+					ImGui::Text("%.2f us/patch unfused, %.2f us/patch in float, %g min margin",
+					            slefeBenchmark.unfusedMicroseconds, slefeBenchmark.floatMicroseconds,
+					            slefeBenchmark.minFloatMargin);
+				}
 			}
 		}
-		else if (tessMode == TESS_UNIFORM)
-			ImGui::DragFloat("Level", &uniformLevel, 0.05, 1, 64, "%.1f");
 		else
-			assert(!"Invalid tessMode");
+			ImGui::DragFloat("Level", &uniformLevel, 0.05, 1, 64, "%.1f");
+
+		RenderReferenceUI();
 
 		if (ImGui::Checkbox("Show parametric error", &showError))
 			RebuildMainProgram();
@@ -1239,17 +4037,67 @@ public:
         {
             ImGui::DragFloat3("Position", value_ptr(modelPos), 0.01, -10, 10, "%.2f");
 			ImGui::DragFloat3("Scale", value_ptr(modelScale), 0.01, -10, 10, "%.2f");
-            if (ImGui::DragInt2("Patches", patchRange, 0.2, 0, NumTeapotPatches))
+            if (ImGui::DragInt2("Patches", patchRange, 0.2, 0, model->numPatches))
             {
-                patchRange[0] = std::min(std::max(patchRange[0], 0), NumTeapotPatches - 1);
-                patchRange[1] = std::max(std::min(patchRange[1], NumTeapotPatches - patchRange[0]), 1);
+                patchRange[0] = std::min(std::max(patchRange[0], 0), model->numPatches - 1);
+                patchRange[1] = std::max(std::min(patchRange[1], model->numPatches - patchRange[0]), 1);
+				BuildPatchClusters();
             }
 			ImGui::Checkbox("Solid", &showModel);
 			ImGui::SameLine();
 			ImGui::Checkbox("Wireframe", &showWireframe);
-            ImGui::Checkbox("Control points", &showControlPoints);
+			// What draws from the whole model on the GPU is off while paging
+			ImGui::SameLine();
+			CheckboxIf(!pageClusters, "Front to back", &sortPatches);
+			ImGui::SameLine();
+			if (CheckboxIf(!pageClusters, "Depth pre-pass (not conservative)", &depthPrepass))
+				RebuildMainProgram();
+			if (depthPrepass)
+			{
+				ImGui::SameLine();
+				ImGui::Text("Can hide geometry behind silhouettes");
+			}
+			CheckboxIf(!pageClusters, "Occlusion culling", &cullOccludedPatches);
+			if (ImGui::Checkbox("16-bit control points", &quantizeControlPoints))
+				UploadControlPoints();
+			if (quantizeControlPoints)
+			{
+				ImGui::SameLine();
+				ImGui::Text("%.2g max. error", max(quantizationError.x, max(quantizationError.y, quantizationError.z)));
+			}
+			if (CheckboxIf(tessMode != TESS_COMPUTE, "Page clusters into a GPU pool", &pageClusters))
+			{
+				// Frees or fills the whole model's buffers
+				UploadControlPointBuffer();
+				slefeBoxBufferChanged = true;
+			}
+			if (pageClusters)
+			{
+				ImGui::SameLine();
+				ImGui::Text("%u of %u clusters resident, %u uploaded", poolStats.numResident,
+				            GLuint(patchClusters.size()), poolStats.numUploaded);
+				ImGui::Text("%u visible, %u not resident yet", poolStats.numVisible, poolStats.numMissing);
+
+				static const GLuint step = 1;
+				if (ImGui::InputScalar("Pool slots", ImGuiDataType_U32, &numPoolSlots, &step))
+				{
+					numPoolSlots = glm::clamp(numPoolSlots, 1u, GLuint(maxModelPatches));
+					AllocateClusterPool();
+				}
+				if (ImGui::InputScalar("Uploads per frame", ImGuiDataType_U32, &maxClusterUploads, &step))
+					maxClusterUploads = std::max(maxClusterUploads, 1u);
+			}
+			if (CheckboxIf(!pageClusters, "Cache tessellation", &cacheTessellation))
+				RebuildMainProgram();
+			if (cacheTessellation && !pageClusters)
+			{
+				ImGui::SameLine();
+				ImGui::Text("%u of %d patches recaptured, %u layouts", numCapturedPatches, model->numPatches,
+				            numCaptureLayouts);
+			}
+			CheckboxIf(!pageClusters, "Control points", &showControlPoints);
 			ImGui::SameLine();
-            ImGui::Checkbox("Control meshes", &showControlMeshes);
+			CheckboxIf(!pageClusters, "Control meshes", &showControlMeshes);
         }
 
         modelViewMatrix = glm::translate(modelViewMatrix, modelPos - modelCentroid);
@@ -1272,13 +4120,11 @@ public:
 			materialChanged|= ImGui::Checkbox("Show normals", &showNormals);
 
 			bool textureChanged = false;
-			textureChanged|= ImGui::ColorEdit3("Diffuse color", value_ptr(diffuseColor1), ImGuiColorEditFlags_NoInputs);
-			textureChanged|= ImGui::Checkbox("Checker", &useTexture);
+			ImGui::ColorEdit3("Diffuse color", value_ptr(diffuseColor1), ImGuiColorEditFlags_NoInputs);
+			ImGui::Checkbox("Checker", &useTexture);
 			if (useTexture)
 			{
-				textureChanged|= ImGui::ColorEdit3("Checker color",
-						value_ptr(diffuseColor2),
-						ImGuiColorEditFlags_NoInputs);
+				ImGui::ColorEdit3("Checker color", value_ptr(diffuseColor2), ImGuiColorEditFlags_NoInputs);
 
 				ImGui::SliderInt("Repeat", &textureRepeat, 1, 25);
 
@@ -1333,6 +4179,8 @@ public:
 		if (window)
 		{
 			ImGui::Text("%.1f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
+			if (cullOccludedPatches && !pageClusters)
+				ImGui::Text("%u of %d patches culled, then re-tested", numOccludedPatches, patchRange[1]);
 
 			if (ImGui::IsWindowHovered())
 			{
@@ -1356,26 +4204,83 @@ public:
     {
 		RenderUI(time);
 
+		// The worker reads the slefe boxes, which are rebuilt when the divs change, including during calibration
+		if (tessMode != TESS_IPASS_PIPELINED || slefesChanged || calibrationRequest != CALIBRATE_NONE)
+			StopTessLevelThread();
+
+		if (calibrationRequest != CALIBRATE_NONE)
+		{
+			CalibrateMysteryFactors(calibrationRequest == CALIBRATE_ALL_DIVS);
+			calibrationRequest = CALIBRATE_NONE;
+		}
+
         glClearColor(backgroundColor.r, backgroundColor.g, backgroundColor.b, 1);
 
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-	    float vertexTessLevels[NumTeapotVertices];
+	    float vertexTessLevels[maxModelVertices];
+		const float *modelTessLevels = vertexTessLevels;
 		if (tessMode == TESS_IPASS)
 			ComputeTessLevels(vertexTessLevels);
 		else if (tessMode == TESS_UNIFORM)
-			for (GLuint i = 0; i < NumTeapotVertices; ++i)
+			for (GLuint i = 0; i < model->numVertices; ++i)
 				vertexTessLevels[i] = uniformLevel;
+		else if (tessMode == TESS_IPASS_PIPELINED)
+		{
+			ComputePipelinedTessLevels(vertexTessLevels);
+
+			// The screen rect display shows the current view rather than the one the levels are for
+			if (showScreenRects)
+				ComputeSlefeRects(slefeEnclosure);
+		}
+		else if (tessMode == TESS_IPASS_GPU || tessMode == TESS_COMPUTE)
+		{
+			if (tessMode == TESS_IPASS_GPU)
+				UploadSlefeBoxes();
+			else
+			{
+				RunComputePass();
+
+				if (validateComputeRequest)
+					ValidateComputePass();
+				validateComputeRequest = false;
+			}
+			modelTessLevels = nullptr;
+
+			// CPU levels only for the screen rect display and the CPU reference, which has no GPU equivalent
+			if (showScreenRects || referenceRequest == REFERENCE_VIEW)
+			{
+				int screenWidth, screenHeight;
+				glfwGetWindowSize(window.get(), &screenWidth, &screenHeight);
+				ComputeSlefeRects(slefeEnclosure);
+				ComputeViewTessLevels(vertexTessLevels, screenWidth, screenHeight);
+			}
+		}
 		else
 			assert(!"Invalid tessMode");
 
-		RenderModel(vertexTessLevels);
+		if (referenceRequest == REFERENCE_VIEW)
+			referenceError = MeasureReferenceView(vertexTessLevels, referencePatchErrors);
+		else if (referenceRequest == REFERENCE_SWEEP)
+			SweepReferenceViews();
+		else if (referenceRequest == REFERENCE_ENCLOSURES)
+			CompareEnclosures();
+		referenceRequest = REFERENCE_NONE;
 
-		if (showControlPoints)
+		RenderModel(modelTessLevels);
+
+		// Before the debug geometry, which would occlude the model
+		if (cullOccludedPatches && modelTessLevels && !pageClusters)
+			ReadBackDepth();
+		else
+			ResetHiZPyramid();
+
+		// From BUFFER_CONTROL_POINTS, which is empty while paging
+		if (showControlPoints && !pageClusters)
 			RenderControlPoints();
-		if (showControlMeshes)
+		if (showControlMeshes && !pageClusters)
 			RenderControlMeshes();
-		if (tessMode == TESS_IPASS)
+		if (tessMode != TESS_UNIFORM)
 		{
 			if (showSlefeTiles)
 				RenderSlefeTiles();
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Slefes.hh"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <glm/glm.hpp>
+
+// Culling of the patches whose control point boxes are behind the max depth of an earlier frame, reduced into a
+// pyramid on the CPU
+
+// The view a depth buffer was rendered with
+struct HiZView
+{
+	glm::mat4 modelViewProjection;
+	int windowWidth, windowHeight;
+	int width, height; // Of the framebuffer
+};
+
+struct HiZLevel
+{
+	int width, height;
+	std::vector<float> depths;
+};
+
+// Each texel is the max of the up to 2x2 texels it covers, so odd sizes round up
+inline void
+ReduceHiZLevel(const float *depths, int width, int height, HiZLevel &level)
+{
+	level.width = (width + 1) / 2;
+	level.height = (height + 1) / 2;
+	level.depths.resize(level.width * level.height);
+
+	for (int y = 0; y < level.height; ++y)
+		for (int x = 0; x < level.width; ++x)
+		{
+			int x1 = std::min(2 * x + 1, width - 1), y1 = std::min(2 * y + 1, height - 1);
+
+			float top = glm::max(depths[2 * y * width + 2 * x], depths[2 * y * width + x1]);
+			float bottom = glm::max(depths[y1 * width + 2 * x], depths[y1 * width + x1]);
+			level.depths[y * level.width + x] = glm::max(top, bottom);
+		}
+}
+
+// Max depths of a depth buffer, from half its resolution down to 1x1
+inline void
+BuildHiZPyramid(const float *depths, int width, int height, std::vector<HiZLevel> &pyramid)
+{
+	pyramid.resize(1);
+	ReduceHiZLevel(depths, width, height, pyramid[0]);
+
+	while (pyramid.back().width > 1 || pyramid.back().height > 1)
+	{
+		HiZLevel level;
+		ReduceHiZLevel(pyramid.back().depths.data(), pyramid.back().width, pyramid.back().height, level);
+		pyramid.push_back(std::move(level));
+	}
+}
+
+// Whether the screen rect of a box was behind the depth in the pyramid, which was rendered with view
+inline bool
+IsBoxOccluded(const std::vector<HiZLevel> &pyramid, const HiZView &view, const AABB &worldBox)
+{
+	if (pyramid.empty())
+		return false;
+
+	glm::vec3 vertices[8];
+	GetAABBVertices(worldBox, vertices);
+
+	// The rect doesn't bound the projection of points behind the eye
+	for (unsigned i = 0; i < 8; ++i)
+		if (!((view.modelViewProjection * glm::vec4(vertices[i], 1)).w > 0))
+			return false;
+
+	SlefeBox box;
+	ComputeSlefeRect(box, vertices, 8, view.modelViewProjection,
+	                 glm::vec3(view.windowWidth / 2.0, view.windowHeight / 2.0, 0.5));
+	const AABB &rect = box.screenAxisBox;
+	if (rect.min.z < 0)
+		return false;
+
+	// Framebuffer pixels under the rect, then the texels of the pyramid's first level, at half resolution
+	glm::vec2 scale = glm::vec2(view.width, view.height) / glm::vec2(view.windowWidth, view.windowHeight);
+	int x0 = std::max(int(floorf(rect.min.x * scale.x)), 0);
+	int y0 = std::max(int(floorf(rect.min.y * scale.y)), 0);
+	int x1 = std::min(int(rect.max.x * scale.x), view.width - 1);
+	int y1 = std::min(int(rect.max.y * scale.y), view.height - 1);
+	if (x0 > x1 || y0 > y1)
+		return false;
+
+	x0>>= 1, x1>>= 1, y0>>= 1, y1>>= 1;
+
+	// The first level the rect covers at most 2x2 texels of
+	unsigned levelIndex = 0;
+	while (levelIndex + 1 < pyramid.size() && (x1 - x0 > 1 || y1 - y0 > 1))
+	{
+		x0>>= 1, x1>>= 1, y0>>= 1, y1>>= 1;
+		++levelIndex;
+	}
+
+	const HiZLevel &level = pyramid[levelIndex];
+	float maxDepth = 0;
+	for (int y = y0; y <= y1; ++y)
+		for (int x = x0; x <= x1; ++x)
+			maxDepth = glm::max(maxDepth, level.depths[y * level.width + x]);
+
+	return rect.min.z > maxDepth;
+}
+
+// Appends the 12 triangles of a box's faces, with its vertices in the GetAABBVertices() order
+inline void
+AppendBoxTriangles(const glm::vec3 boxVertices[8], std::vector<glm::vec3> &vertices, std::vector<unsigned> &indices)
+{
+	static const unsigned faces[6][4] =
+	{
+		{0, 1, 2, 3}, {4, 5, 6, 7}, // x
+		{0, 1, 5, 4}, {3, 2, 6, 7}, // y
+		{0, 3, 7, 4}, {1, 2, 6, 5}  // z
+	};
+
+	unsigned start = vertices.size();
+	vertices.insert(vertices.end(), boxVertices, boxVertices + 8);
+	for (const unsigned (&face)[4] : faces)
+		for (unsigned corner : {0, 1, 2, 0, 2, 3})
+			indices.push_back(start + face[corner]);
+}
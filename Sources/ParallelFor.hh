@@ -0,0 +1,30 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Calls func(i) for each i in [begin, end), spread over the hardware threads. The calling thread does its share too.
+template<typename FuncT>
+static void
+ParallelFor(int begin, int end, FuncT func)
+{
+	std::atomic<int> next(begin);
+	auto worker = [&]()
+	{
+		for (int i = next++; i < end; i = next++)
+			func(i);
+	};
+
+	unsigned numThreads = std::min(std::max(std::thread::hardware_concurrency(), 1u), unsigned(std::max(end - begin, 1)));
+
+	std::vector<std::thread> threads;
+	for (unsigned i = 1; i < numThreads; ++i)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (auto &thread : threads)
+		thread.join();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "SlefeKernels.hh"
+#include "../Data/Teapot.h"
+#include "../Data/Torus.h"
+#include "../Data/Gourd.h"
+
+// The Bezier and B-spline patch models, which are compiled in
+
+static const unsigned threeD = 3;
+// More than the 32 GL_MAX_PATCH_VERTICES every GL 4 implementation has, which LoadModel() checks models against
+static const unsigned maxPatchVertices = maxBezierSlefeCoeffs;
+
+// Control points, and the (degree[0] + 1) x (degree[1] + 1) of them each patch is made of, in rows along the second
+// index. The second index runs along the tess coordinates' x, and the first along their y.
+struct PatchModel
+{
+	const float (*vertices)[threeD];
+	unsigned numVertices;
+	const unsigned *indices;
+	int numPatches;
+	unsigned degree[2];
+	bool bSpline; // Spans of a uniform bicubic B-spline surface, which share control points, rather than Bezier patches
+
+	unsigned
+	GetNumPatchVertices() const
+	{
+		return (degree[0] + 1) * (degree[1] + 1);
+	}
+
+	const unsigned *
+	GetPatchIndices(int patchIndex) const
+	{
+		return indices + patchIndex * GetNumPatchVertices();
+	}
+
+	unsigned
+	GetIndex(int patchIndex, unsigned u, unsigned v) const
+	{
+		return GetPatchIndices(patchIndex)[u * (degree[1] + 1) + v];
+	}
+};
+
+enum {MODEL_TEAPOT, MODEL_TORUS, MODEL_GOURD, NUM_MODELS}; // patchModels
+static const PatchModel patchModels[NUM_MODELS] =
+{
+	{TeapotVertices, NumTeapotVertices, &TeapotIndices[0][0][0], NumTeapotPatches, {3, 3}, false},
+	{TorusVertices, NumTorusVertices, &TorusIndices[0][0][0], NumTorusPatches, {3, 3}, true},
+	{GourdVertices, NumGourdVertices, &GourdIndices[0][0][0], NumGourdPatches, {4, 2}, false}
+};
+static const unsigned maxModelVertices =
+		(NumTeapotVertices > NumTorusVertices && NumTeapotVertices > NumGourdVertices) ? NumTeapotVertices :
+		(NumTorusVertices > NumGourdVertices) ? NumTorusVertices : NumGourdVertices;
+static const int maxModelPatches =
+		(NumTeapotPatches > NumTorusPatches && NumTeapotPatches > NumGourdPatches) ? NumTeapotPatches :
+		(NumTorusPatches > NumGourdPatches) ? NumTorusPatches : NumGourdPatches;
+static_assert(NumGourdVerticesPerPatch <= maxPatchVertices, "Gourd patches have too many control points");
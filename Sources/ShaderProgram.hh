@@ -3,6 +3,10 @@
 #include <glm/mat4x4.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
 
 class ShaderProgram
 {
@@ -12,6 +16,20 @@ class ShaderProgram
     std::string version, macros;
     std::vector<std::string> includes;
 
+	// Shaders are compiled lazily in Link() so that a cached program binary can skip compilation entirely
+	struct Stage
+	{
+		GLenum type;
+		std::string path;
+		std::vector<std::string> sources;
+	};
+	std::vector<Stage> stages;
+	GLbitfield stageBits = 0;
+	bool separable = false;
+	std::vector<std::string> feedbackVaryings;
+	std::string binaryCacheDir;
+	std::unordered_map<std::string, GLint> uniformLocations; // Reflected by Link()
+
 	void
 	CheckShaderStatus(GLuint object,
 					  GLenum pname,
@@ -45,48 +63,121 @@ class ShaderProgram
 		return oss.str();
 	}
 
-public:
-	ShaderProgram(const char *version = "#version 410 core\n", const char *macros = "")
-			: version(version), macros(macros)
+	static void
+	HashBytes(uint64_t &hash, const void *data, size_t size)
 	{
-		program = glCreateProgram();
+		// 64-bit FNV-1a, which is stable across runs unlike std::hash
+		const unsigned char *bytes = static_cast<const unsigned char *>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash^= bytes[i];
+			hash*= 0x100000001b3ull;
+		}
 	}
 
-	~ShaderProgram()
+	static void
+	HashString(uint64_t &hash, const std::string &str)
 	{
-		glDeleteProgram(program);
+		HashBytes(hash, str.data(), str.size() + 1);
 	}
 
-    void
-    LoadShader(GLenum type, const std::string &path)
-    {
-        GLuint shader = glCreateShader(type);
+	std::string
+	GetBinaryCachePath()
+	{
+		uint64_t hash = 0xcbf29ce484222325ull;
 
-	    std::vector<const GLchar *> sources;
+		// A driver update changes the binary format, so key on the implementation as well as the sources
+		HashString(hash, (const char *)glGetString(GL_RENDERER));
+		HashString(hash, (const char *)glGetString(GL_VERSION));
+		HashBytes(hash, &separable, sizeof(separable));
+		for (auto &varying : feedbackVaryings)
+			HashString(hash, varying);
 
-	    if (!version.empty())
-		    sources.push_back(version.c_str());
+		for (auto &stage : stages)
+		{
+			HashBytes(hash, &stage.type, sizeof(stage.type));
+			for (auto &source : stage.sources)
+				HashString(hash, source);
+		}
 
-	    if (!macros.empty())
-			sources.push_back(macros.c_str());
+		std::ostringstream oss;
+		oss << binaryCacheDir << '/' << std::hex << hash << ".bin";
+		return oss.str();
+	}
+
+	bool
+	LoadBinary(const std::string &path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+			return false;
+
+		GLenum format;
+		file.read(reinterpret_cast<char *>(&format), sizeof(format));
+
+		std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		if (!file.eof() || binary.empty())
+			return false;
+
+		glProgramBinary(program, format, binary.data(), binary.size());
+
+		// Fails if the driver rejects the binary, in which case we silently fall back to compiling
+		GLint status;
+		glGetProgramiv(program, GL_LINK_STATUS, &status);
+		return status;
+	}
 
-	    for (auto &include : includes)
-	    	sources.push_back(include.c_str());
+	void
+	SaveBinary(const std::string &path)
+	{
+		GLint length;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (!length)
+			return;
+
+		std::vector<char> binary(length);
+		GLenum format;
+		glGetProgramBinary(program, length, NULL, &format, binary.data());
+
+		// Written aside and renamed into place, so that a reader never sees a partial binary, even from another thread
+		// saving the same program or from a crash midway. The name is per thread so that two writers don't mix.
+		std::string tempPath = path + '.' + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) +
+		                       ".tmp";
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		if (file)
+		{
+			file.write(reinterpret_cast<const char *>(&format), sizeof(format));
+			file.write(binary.data(), binary.size());
+			file.close();
+		}
 
-		std::string source = ReadFile(path);
-		sources.push_back(source.c_str());
+		if (!file.good() || std::rename(tempPath.c_str(), path.c_str()))
+		{
+			std::clog << "Could not write program binary " << path << std::endl;
+			std::remove(tempPath.c_str());
+		}
+	}
+
+	GLuint
+	CompileShader(const Stage &stage)
+	{
+		GLuint shader = glCreateShader(stage.type);
+
+		std::vector<const GLchar *> sources;
+		for (auto &source : stage.sources)
+			sources.push_back(source.c_str());
 
         glShaderSource(shader, sources.size(), sources.data(), NULL);
 
         glCompileShader(shader);
         try
         {
-            CheckShaderStatus(shader, GL_COMPILE_STATUS, "glCompileShader(" + path + ")",
+            CheckShaderStatus(shader, GL_COMPILE_STATUS, "glCompileShader(" + stage.path + ")",
                               glGetShaderiv, glGetShaderInfoLog);
         }
         catch (std::runtime_error &error)
         {
-			std::clog << "Error while compiling shader " << path << ':' << std::endl;
+			std::clog << "Error while compiling shader " << stage.path << ':' << std::endl;
 
 			GLint sourceLength;
 			glGetShaderiv(shader, GL_SHADER_SOURCE_LENGTH, &sourceLength);
@@ -120,10 +211,91 @@ public:
 
 			std::clog << std::endl << "<<<<<<<<<" << std::endl;
 
+			glDeleteShader(shader);
 			throw;
         }
 
-        glAttachShader(program, shader);
+		return shader;
+	}
+
+	void
+	ReflectUniforms()
+	{
+		uniformLocations.clear();
+
+		GLint numUniforms, maxNameLength;
+		glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &numUniforms);
+		glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+		std::vector<GLchar> name(maxNameLength + 1);
+		for (GLint i = 0; i < numUniforms; ++i)
+		{
+			GLsizei length;
+			GLint size;
+			GLenum type;
+			glGetActiveUniform(program, i, name.size(), &length, &size, &type, name.data());
+
+			std::string uniformName(name.data(), length);
+			GLint location = glGetUniformLocation(program, uniformName.c_str());
+			if (location == -1)
+				continue; // Uniform block member
+
+			uniformLocations[uniformName] = location;
+
+			// Arrays are reported as "name[0]" but usually looked up as just "name"
+			static const std::string subscript = "[0]";
+			if (uniformName.size() > subscript.size() &&
+					uniformName.compare(uniformName.size() - subscript.size(), subscript.size(), subscript) == 0)
+				uniformLocations[uniformName.substr(0, uniformName.size() - subscript.size())] = location;
+		}
+	}
+
+public:
+	ShaderProgram(const char *version = "#version 410 core\n", const char *macros = "")
+			: version(version), macros(macros)
+	{
+		program = glCreateProgram();
+	}
+
+	~ShaderProgram()
+	{
+		glDeleteProgram(program);
+	}
+
+	static GLbitfield
+	GetStageBit(GLenum type)
+	{
+		switch (type)
+		{
+			case GL_VERTEX_SHADER: return GL_VERTEX_SHADER_BIT;
+			case GL_TESS_CONTROL_SHADER: return GL_TESS_CONTROL_SHADER_BIT;
+			case GL_TESS_EVALUATION_SHADER: return GL_TESS_EVALUATION_SHADER_BIT;
+			case GL_GEOMETRY_SHADER: return GL_GEOMETRY_SHADER_BIT;
+			case GL_FRAGMENT_SHADER: return GL_FRAGMENT_SHADER_BIT;
+			case GL_COMPUTE_SHADER: return GL_COMPUTE_SHADER_BIT;
+			default: throw std::runtime_error("Unknown shader type");
+		}
+	}
+
+    void
+    LoadShader(GLenum type, const std::string &path)
+    {
+		stageBits|= GetStageBit(type);
+
+		Stage stage = {type, path, {}};
+
+		if (!version.empty())
+			stage.sources.push_back(version);
+
+		if (!macros.empty())
+			stage.sources.push_back(macros);
+
+		for (auto &include : includes)
+			stage.sources.push_back(include);
+
+		stage.sources.push_back(ReadFile(path));
+
+		stages.push_back(std::move(stage));
     }
 
     void
@@ -132,14 +304,92 @@ public:
 		includes.push_back(ReadFile(path));
     }
 
+	// Programs linked after this are stored in, and loaded from, dir with glGetProgramBinary()/glProgramBinary()
+	void
+	SetBinaryCache(const std::string &dir)
+	{
+		GLint numFormats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+		if (numFormats > 0)
+			binaryCacheDir = dir;
+	}
+
+	// Must be called before Link() for the program to be used with a ProgramPipeline
+	void
+	SetSeparable()
+	{
+		separable = true;
+	}
+
+	// Must be called before Link(); the outputs of the last vertex processing stage are captured interleaved, in this
+	// order, into transform feedback buffer 0
+	void
+	SetTransformFeedbackVaryings(const std::vector<std::string> &varyings)
+	{
+		feedbackVaryings = varyings;
+	}
+
 	void
 	Link()
 	{
-        glLinkProgram(program);
-        CheckShaderStatus(program, GL_LINK_STATUS, "glLinkProgram()", glGetProgramiv, glGetProgramInfoLog);
+		glProgramParameteri(program, GL_PROGRAM_SEPARABLE, separable);
+
+		std::string cachePath;
+		if (!binaryCacheDir.empty())
+			cachePath = GetBinaryCachePath();
+
+		if (cachePath.empty() || !LoadBinary(cachePath))
+		{
+			std::vector<GLuint> shaders;
+			try
+			{
+				for (auto &stage : stages)
+				{
+					shaders.push_back(CompileShader(stage));
+					glAttachShader(program, shaders.back());
+				}
+			}
+			catch (std::runtime_error &)
+			{
+				for (GLuint shader : shaders)
+					glDeleteShader(shader);
+				throw;
+			}
+
+			if (!cachePath.empty())
+				glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+			if (!feedbackVaryings.empty())
+			{
+				std::vector<const GLchar *> names;
+				for (auto &varying : feedbackVaryings)
+					names.push_back(varying.c_str());
+
+				glTransformFeedbackVaryings(program, names.size(), names.data(), GL_INTERLEAVED_ATTRIBS);
+			}
+
+			glLinkProgram(program);
+
+			for (GLuint shader : shaders)
+			{
+				glDetachShader(program, shader);
+				glDeleteShader(shader);
+			}
+
+			CheckShaderStatus(program, GL_LINK_STATUS, "glLinkProgram()", glGetProgramiv, glGetProgramInfoLog);
+
+			if (!cachePath.empty())
+				SaveBinary(cachePath);
+		}
+
+		stages.clear();
+
+		ReflectUniforms();
 
-        projectionMatrixLocation = GetUniformLocation("ProjectionMatrix");
-        modelViewMatrixLocation = GetUniformLocation("ModelViewMatrix");
+        // Separable programs may contain only some of the stages using these, and compute programs none of them
+        bool cameraRequired = (!separable && !(stageBits & GL_COMPUTE_SHADER_BIT));
+        projectionMatrixLocation = GetUniformLocation("ProjectionMatrix", cameraRequired);
+        modelViewMatrixLocation = GetUniformLocation("ModelViewMatrix", cameraRequired);
 	}
 
 	void
@@ -148,49 +398,73 @@ public:
 		glUseProgram(program);
 	}
 
+	GLuint
+	GetName() const
+	{
+		return program;
+	}
+
+	GLbitfield
+	GetStageBits() const
+	{
+		return stageBits;
+	}
+
     GLint
     GetUniformLocation(const char *name, bool required = true)
     {
-        GLint location = glGetUniformLocation(program, name);
+		auto it = uniformLocations.find(name);
+		GLint location = (it != uniformLocations.end()) ? it->second : -1;
         if (location == -1 && required)
             throw std::runtime_error(std::string("Uniform location ") + name + " was not found in program");
 
         return location;
     }
 
+	// Uniform blocks that aren't active in this program are ignored
+	void
+	BindUniformBlock(const char *name, GLuint binding)
+	{
+		GLuint index = glGetUniformBlockIndex(program, name);
+		if (index != GL_INVALID_INDEX)
+			glUniformBlockBinding(program, index, binding);
+	}
+
+	void
+	SetUniform(GLint location, GLint i)
+	{
+		glProgramUniform1i(program, location, i);
+	}
+
 	void
-	SetUniform(const char *name, GLint i)
+	SetUniform(GLint location, float f)
 	{
-		GLint location = GetUniformLocation(name);
-		glUniform1i(location, i);
+		glProgramUniform1f(program, location, f);
 	}
 
 	void
-	SetUniform(const char *name, float f)
+	SetUniform(GLint location, const glm::ivec2 &v)
 	{
-		GLint location = GetUniformLocation(name);
-		glUniform1f(location, f);
+		glProgramUniform2iv(program, location, 1, value_ptr(v));
 	}
 
 	void
-	SetUniform(const char *name, const glm::ivec2 &v)
+	SetUniform(GLint location, const glm::vec3 &v)
 	{
-		GLint location = GetUniformLocation(name);
-		glUniform2iv(location, 1, value_ptr(v));
+		glProgramUniform3fv(program, location, 1, value_ptr(v));
 	}
 
 	void
-	SetUniform(const char *name, const glm::vec3 &v)
+	SetUniform(GLint location, const glm::vec4 &v)
 	{
-		GLint location = GetUniformLocation(name);
-		glUniform3fv(location, 1, value_ptr(v));
+		glProgramUniform4fv(program, location, 1, value_ptr(v));
 	}
 
+	template<typename T>
 	void
-	SetUniform(const char *name, const glm::vec4 &v)
+	SetUniform(const char *name, const T &value)
 	{
-		GLint location = GetUniformLocation(name);
-		glUniform4fv(location, 1, value_ptr(v));
+		SetUniform(GetUniformLocation(name), value);
 	}
 
     GLint
@@ -206,7 +480,44 @@ public:
 	void
 	SetCamera(glm::mat4 &modelView, glm::mat4 &projection)
 	{
-        glUniformMatrix4fv(modelViewMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelView));
-        glUniformMatrix4fv(projectionMatrixLocation, 1, GL_FALSE, glm::value_ptr(projection));
+        glProgramUniformMatrix4fv(program, modelViewMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelView));
+        glProgramUniformMatrix4fv(program, projectionMatrixLocation, 1, GL_FALSE, glm::value_ptr(projection));
+	}
+};
+
+// Mixes the stages of separable ShaderPrograms at bind time, so changing one stage doesn't relink the others
+class ProgramPipeline
+{
+	GLuint pipeline;
+
+public:
+	ProgramPipeline()
+	{
+		glGenProgramPipelines(1, &pipeline);
+	}
+
+	~ProgramPipeline()
+	{
+		glDeleteProgramPipelines(1, &pipeline);
+	}
+
+	void
+	UseStages(const ShaderProgram &program)
+	{
+		glUseProgramStages(pipeline, program.GetStageBits(), program.GetName());
+	}
+
+	void
+	ClearStages(GLbitfield stages)
+	{
+		glUseProgramStages(pipeline, stages, 0);
+	}
+
+	void
+	Bind()
+	{
+		// A program bound with glUseProgram() takes precedence over the pipeline
+		glUseProgram(0);
+		glBindProgramPipeline(pipeline);
 	}
 };
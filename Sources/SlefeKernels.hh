@@ -0,0 +1,344 @@
+#pragma once
+
+#include "SlefeTables.hh"
+#include <SubLiME.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// SubLiME's uniSlefe() and tpSlefe(), and a tensor product of bspSlefe(), for fixed degrees and number of pieces, so
+// that the compiler sees the bound tables as constants and every loop count as a constant it can unroll, instead of
+// going through the library's runtime-sized tables and scratch buffers. In REAL, they give the same results as the
+// library, operation for operation; in float, see BezierTensorSlefeInflated().
+
+// Tensor-product kernels are only built for patches of up to this many coefficients, enough for biquintic patches
+static const int maxBezierSlefeCoeffs = 36;
+
+// uniSlefe() for coefficients stride apart, with only its upper (Upper) or lower output
+template<int Degree, int Divs, bool Upper, typename Real>
+inline void
+BezierUniSlefe(const Real *coeff, int stride, Real *bound, int boundStride)
+{
+	typedef BezierSlefeBounds<Degree> Bounds;
+
+	Real differences[Degree - 1];
+	for (int j = 0; j < Degree - 1; ++j)
+		differences[j] = coeff[j * stride] - 2 * coeff[(j + 1) * stride] + coeff[(j + 2) * stride];
+
+	for (int i = 0; i < Divs + 1; ++i)
+	{
+		Real u = Real(i) / Divs;
+		Real &point = bound[i * boundStride];
+
+		point = (1 - u) * coeff[0] + u * coeff[Degree * stride];
+
+		for (int j = 0; j < Degree - 1; ++j)
+		{
+			// The upper bound takes the upper table for positive differences, and the lower bound the lower one
+			bool upperTable = ((differences[j] > 0) == Upper);
+			point+= Real(Bounds::Get(Divs, j, (upperTable) ? 0 : 1, i)) * differences[j];
+		}
+	}
+}
+
+// The upper bound of upperCoeff and the lower bound of lowerCoeff in one pass, which can be the same coefficients.
+// Each term indexes the table by the sign of its difference rather than branching on it as uniSlefe() does, so the
+// two independent sums interleave without mispredictions on the random signs.
+template<int Degree, int Divs, typename Real>
+inline void
+BezierUniSlefePair(const Real *upperCoeff, const Real *lowerCoeff, int stride, Real *upper, Real *lower,
+		int boundStride)
+{
+	typedef BezierSlefeBounds<Degree> Bounds;
+
+	Real upperDifferences[Degree - 1], lowerDifferences[Degree - 1];
+	for (int j = 0; j < Degree - 1; ++j)
+	{
+		upperDifferences[j] = upperCoeff[j * stride] - 2 * upperCoeff[(j + 1) * stride] + upperCoeff[(j + 2) * stride];
+		lowerDifferences[j] = lowerCoeff[j * stride] - 2 * lowerCoeff[(j + 1) * stride] + lowerCoeff[(j + 2) * stride];
+	}
+
+	for (int i = 0; i < Divs + 1; ++i)
+	{
+		Real u = Real(i) / Divs;
+		Real upperPoint = (1 - u) * upperCoeff[0] + u * upperCoeff[Degree * stride];
+		Real lowerPoint = (1 - u) * lowerCoeff[0] + u * lowerCoeff[Degree * stride];
+
+		for (int j = 0; j < Degree - 1; ++j)
+		{
+			int upperTable = (upperDifferences[j] > 0) ? 0 : 1, lowerTable = (lowerDifferences[j] > 0) ? 1 : 0;
+
+			upperPoint+= Real(Bounds::Get(Divs, j, upperTable, i)) * upperDifferences[j];
+			lowerPoint+= Real(Bounds::Get(Divs, j, lowerTable, i)) * lowerDifferences[j];
+		}
+
+		upper[i * boundStride] = upperPoint;
+		lower[i * boundStride] = lowerPoint;
+	}
+}
+
+// tpSlefe() with the same argument order, for one coordinate of a patch of degree DegreeU along the rows of its
+// (DegreeU + 1) x (DegreeV + 1) coefficients and DegreeV along the columns. Fused uses BezierUniSlefePair(), and the
+// separate BezierUniSlefe() calls otherwise, as tpSlefe() does.
+template<int DegreeU, int DegreeV, int Divs, typename Real, bool Fused = true>
+inline void
+BezierTensorSlefe(const Real *coeff, int strideU, int strideV, Real *upper, Real *lower,
+		int slefeStrideU, int slefeStrideV)
+{
+	Real rowUpper[DegreeU + 1][Divs + 1], rowLower[DegreeU + 1][Divs + 1];
+
+	// Step 1: bound each row of coefficients along v
+	for (int i = 0; i < DegreeU + 1; ++i)
+	{
+		const Real *row = coeff + i * strideU;
+		if (Fused)
+			BezierUniSlefePair<DegreeV, Divs, Real>(row, row, strideV, rowUpper[i], rowLower[i], 1);
+		else
+		{
+			BezierUniSlefe<DegreeV, Divs, true, Real>(row, strideV, rowUpper[i], 1);
+			BezierUniSlefe<DegreeV, Divs, false, Real>(row, strideV, rowLower[i], 1);
+		}
+	}
+
+	// Step 2: bound the upper rows from above and the lower rows from below along u
+	for (int i = 0; i < Divs + 1; ++i)
+	{
+		Real *upperColumn = upper + i * slefeStrideV, *lowerColumn = lower + i * slefeStrideV;
+		if (Fused)
+			BezierUniSlefePair<DegreeU, Divs, Real>(&rowUpper[0][i], &rowLower[0][i], Divs + 1,
+			                                        upperColumn, lowerColumn, slefeStrideU);
+		else
+		{
+			BezierUniSlefe<DegreeU, Divs, true, Real>(&rowUpper[0][i], Divs + 1, upperColumn, slefeStrideU);
+			BezierUniSlefe<DegreeU, Divs, false, Real>(&rowLower[0][i], Divs + 1, lowerColumn, slefeStrideU);
+		}
+	}
+}
+
+// Picks the BezierTensorSlefe() for a runtime divs
+template<int DegreeU, int DegreeV, int Divs = maxBezierSlefeDivs>
+struct BezierTensorSlefeDispatch
+{
+	template<bool Fused = true, typename Real>
+	static inline bool
+	Run(int divs, const Real *coeff, int strideU, int strideV, Real *upper, Real *lower,
+			int slefeStrideU, int slefeStrideV)
+	{
+		if (divs != Divs)
+			return BezierTensorSlefeDispatch<DegreeU, DegreeV, Divs - 1>::template Run<Fused>(divs, coeff,
+			                                                                                  strideU, strideV,
+			                                                                                  upper, lower,
+			                                                                                  slefeStrideU,
+			                                                                                  slefeStrideV);
+
+		BezierTensorSlefe<DegreeU, DegreeV, Divs, Real, Fused>(coeff, strideU, strideV, upper, lower,
+		                                                       slefeStrideU, slefeStrideV);
+		return true;
+	}
+};
+
+template<int DegreeU, int DegreeV>
+struct BezierTensorSlefeDispatch<DegreeU, DegreeV, 0>
+{
+	template<bool Fused = true, typename Real>
+	static inline bool
+	Run(int, const Real *, int, int, Real *, Real *, int, int)
+	{
+		return false;
+	}
+};
+
+// Picks the BezierTensorSlefeDispatch for runtime degrees from 2 up, counting DegreeU down and then DegreeV
+template<int DegreeU = maxBezierSlefeDegree, int DegreeV = maxBezierSlefeDegree>
+struct BezierTensorSlefeDegreeDispatch
+{
+	template<bool Fused = true, typename Real>
+	static inline bool
+	Run(int degreeU, int degreeV, int divs, const Real *coeff, int strideU, int strideV, Real *upper, Real *lower,
+			int slefeStrideU, int slefeStrideV)
+	{
+		if (degreeU != DegreeU)
+			return BezierTensorSlefeDegreeDispatch<DegreeU - 1, DegreeV>::template Run<Fused>(
+					degreeU, degreeV, divs, coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV);
+		if (degreeV != DegreeV)
+			return BezierTensorSlefeDegreeDispatch<DegreeU, DegreeV - 1>::template Run<Fused>(
+					degreeU, degreeV, divs, coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV);
+
+		// Patches with too many coefficients get the divs = 0 dispatch, so their kernels aren't built
+		static const bool built = ((DegreeU + 1) * (DegreeV + 1) <= maxBezierSlefeCoeffs);
+		return BezierTensorSlefeDispatch<DegreeU, DegreeV, (built) ? maxBezierSlefeDivs : 0>::template Run<Fused>(
+				divs, coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV);
+	}
+};
+
+template<int DegreeV>
+struct BezierTensorSlefeDegreeDispatch<1, DegreeV>
+{
+	template<bool Fused = true, typename Real>
+	static inline bool
+	Run(int, int, int, const Real *, int, int, Real *, Real *, int, int)
+	{
+		return false;
+	}
+};
+
+template<int DegreeU>
+struct BezierTensorSlefeDegreeDispatch<DegreeU, 1>
+{
+	template<bool Fused = true, typename Real>
+	static inline bool
+	Run(int, int, int, const Real *, int, int, Real *, Real *, int, int)
+	{
+		return false;
+	}
+};
+
+// How far rounding in Real can move BezierTensorSlefe()'s outputs, relative to the largest absolute coefficient,
+// where degree is the larger of the two. Each uniSlefe() step adds the chord to degree - 1 tabulated multiples of
+// second differences, with absolute weights summing to at most growth = degree^2 for the built-in tables, and rounds
+// about 3 * degree times; the second step also scales the first one's error by growth. Doubled for the tables' own
+// rounding to Real, and to spare.
+template<typename Real>
+constexpr Real
+BezierSlefeRoundingBound(int degree)
+{
+	return 2 * (degree * degree + 1) * 3 * degree * degree * degree * std::numeric_limits<Real>::epsilon();
+}
+
+// Pushes both bounds of a slefe computed in Real out by BezierSlefeRoundingBound(), relative to the largest of the
+// (degreeU + 1) x (degreeV + 1) coefficients
+template<typename Real>
+inline void
+InflateTensorSlefe(int degreeU, int degreeV, int divs, const Real *coeff, int strideU, int strideV,
+		Real *upper, Real *lower, int slefeStrideU, int slefeStrideV)
+{
+	Real scale = 0;
+	for (int i = 0; i <= degreeU; ++i)
+		for (int j = 0; j <= degreeV; ++j)
+			scale = std::fmax(scale, std::fabs(coeff[i * strideU + j * strideV]));
+
+	Real inflation = scale * BezierSlefeRoundingBound<Real>(std::max(degreeU, degreeV));
+	for (int i = 0; i <= divs; ++i)
+		for (int j = 0; j <= divs; ++j)
+		{
+			upper[i * slefeStrideU + j * slefeStrideV]+= inflation;
+			lower[i * slefeStrideU + j * slefeStrideV]-= inflation;
+		}
+}
+
+// BezierTensorSlefeDegreeDispatch::Run() with both bounds pushed out by BezierSlefeRoundingBound(), so that a slefe
+// computed in float still encloses the patch
+template<typename Real>
+inline bool
+BezierTensorSlefeInflated(int degreeU, int degreeV, int divs, const Real *coeff, int strideU, int strideV,
+		Real *upper, Real *lower, int slefeStrideU, int slefeStrideV)
+{
+	if (!BezierTensorSlefeDegreeDispatch<>::Run(degreeU, degreeV, divs, coeff, strideU, strideV, upper, lower,
+	                                            slefeStrideU, slefeStrideV))
+		return false;
+
+	InflateTensorSlefe(degreeU, degreeV, divs, coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV);
+	return true;
+}
+
+// bspSlefe() for the one span of a uniform cubic B-spline with 4 coefficients stride apart, with only its upper
+// (Upper) or lower output. The span lies along the middle leg of the control polygon, and each end's second
+// difference takes the table from its own side.
+template<int Divs, bool Upper, typename Real>
+inline void
+BSplineUniSlefe(const Real *coeff, int stride, Real *bound, int boundStride)
+{
+	const REAL (&plus)[maxBezierSlefeDivs + 1] = cubicBSplineSlefeBounds[Divs][0];
+	const REAL (&minus)[maxBezierSlefeDivs + 1] = cubicBSplineSlefeBounds[Divs][1];
+
+	Real start = coeff[0] - 2 * coeff[stride] + coeff[2 * stride];
+	Real end = coeff[stride] - 2 * coeff[2 * stride] + coeff[3 * stride];
+
+	// As bspSlefe() writes them, so that the results match it in REAL
+	Real startPlus = (start > 0) ? start : 0, startMinus = (start < 0) ? start : 0;
+	Real endPlus = (end > 0) ? end : 0, endMinus = (end < 0) ? end : 0;
+
+	for (int i = 0; i < Divs + 1; ++i)
+	{
+		Real u = Real(i) / Divs;
+		Real chord = (1 - u) * coeff[stride] + u * coeff[2 * stride];
+		Real offset;
+
+		if (Upper)
+			offset = startPlus * Real(plus[i]) + startMinus * Real(minus[i]) +
+					endPlus * Real(plus[Divs - i]) + endMinus * Real(minus[Divs - i]);
+		else
+			offset = startMinus * Real(plus[i]) + startPlus * Real(minus[i]) +
+					endMinus * Real(plus[Divs - i]) + endPlus * Real(minus[Divs - i]);
+
+		bound[i * boundStride] = chord + offset;
+	}
+}
+
+// tpSlefe()'s two steps with bspSlefe() in place of uniSlefe(), for one coordinate of a bicubic B-spline span given
+// by its 4x4 coefficients. B-spline basis functions are non-negative like Bernstein polynomials, so bounding the rows
+// and then their bounds still encloses the surface.
+template<int Divs, typename Real>
+inline void
+BSplineTensorSlefe(const Real *coeff, int strideU, int strideV, Real *upper, Real *lower,
+		int slefeStrideU, int slefeStrideV)
+{
+	Real rowUpper[4][Divs + 1], rowLower[4][Divs + 1];
+
+	// Step 1: bound each row of coefficients along v
+	for (int i = 0; i < 4; ++i)
+	{
+		BSplineUniSlefe<Divs, true, Real>(coeff + i * strideU, strideV, rowUpper[i], 1);
+		BSplineUniSlefe<Divs, false, Real>(coeff + i * strideU, strideV, rowLower[i], 1);
+	}
+
+	// Step 2: bound the upper rows from above and the lower rows from below along u
+	for (int i = 0; i < Divs + 1; ++i)
+	{
+		BSplineUniSlefe<Divs, true, Real>(&rowUpper[0][i], Divs + 1, upper + i * slefeStrideV, slefeStrideU);
+		BSplineUniSlefe<Divs, false, Real>(&rowLower[0][i], Divs + 1, lower + i * slefeStrideV, slefeStrideU);
+	}
+}
+
+// Picks the BSplineTensorSlefe() for a runtime divs
+template<int Divs = maxBezierSlefeDivs>
+struct BSplineTensorSlefeDispatch
+{
+	template<typename Real>
+	static inline bool
+	Run(int divs, const Real *coeff, int strideU, int strideV, Real *upper, Real *lower,
+			int slefeStrideU, int slefeStrideV)
+	{
+		if (divs != Divs)
+			return BSplineTensorSlefeDispatch<Divs - 1>::Run(divs, coeff, strideU, strideV, upper, lower,
+			                                                 slefeStrideU, slefeStrideV);
+
+		BSplineTensorSlefe<Divs, Real>(coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV);
+		return true;
+	}
+};
+
+template<>
+struct BSplineTensorSlefeDispatch<0>
+{
+	template<typename Real>
+	static inline bool
+	Run(int, const Real *, int, int, Real *, Real *, int, int)
+	{
+		return false;
+	}
+};
+
+// BSplineTensorSlefeDispatch::Run() inflated like BezierTensorSlefeInflated(). The cubic Bezier bound covers it: each
+// bspSlefe() step has fewer roundings than a cubic uniSlefe() step, and absolute weights summing to at most 1 + 8 / 6.
+template<typename Real>
+inline bool
+BSplineTensorSlefeInflated(int divs, const Real *coeff, int strideU, int strideV, Real *upper, Real *lower,
+		int slefeStrideU, int slefeStrideV)
+{
+	if (!BSplineTensorSlefeDispatch<>::Run(divs, coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV))
+		return false;
+
+	InflateTensorSlefe(3, 3, divs, coeff, strideU, strideV, upper, lower, slefeStrideU, slefeStrideV);
+	return true;
+}
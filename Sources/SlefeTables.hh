@@ -0,0 +1,1939 @@
+#pragma once
+
+#include <SubLiME.h>
+
+// SubLiME's range files as constants, for the kernels in SlefeKernels.hh: the bounds on the second difference terms
+// of uniSlefe() for degrees 2 to 9, and those of bspSlefe() for cubics, at 1 to 9 pieces. Copied as written, so that
+// the values are the ones the library reads.
+
+static const int maxBezierSlefeDivs = 9;
+static const int maxBezierSlefeDegree = 9;
+
+// range/unirange-2_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL quadraticSlefeBounds[maxBezierSlefeDivs + 1][1][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.2500000000, -0.2500000000}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.2500000000, 0.0000000000},
+			{-0.0625000000, -0.3125000000, -0.0625000000}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.2222222222, -0.2222222222, 0.0000000000},
+			{-0.0277777778, -0.2500000000, -0.2500000000, -0.0277777777}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.1875000000, -0.2500000000, -0.1875000000, 0.0000000000},
+			{-0.0156250000, -0.2031250000, -0.2656250000, -0.2031250000, -0.0156250000}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.1600000000, -0.2400000000, -0.2400000000, -0.1600000000, 0.0000000000},
+			{-0.0100000000, -0.1700000000, -0.2500000000, -0.2500000000, -0.1700000000, -0.0100000000}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.1388888889, -0.2222222222, -0.2500000000, -0.2222222222,
+			 -0.1388888889, 0.0000000000},
+			{-0.0069444445, -0.1458333334, -0.2291666667, -0.2569444445, -0.2291666667,
+			 -0.1458333334, -0.0069444444}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.1224489796, -0.2040816327, -0.2448979592, -0.2448979592,
+			 -0.2040816327, -0.1224489796, 0.0000000000},
+			{-0.0051020408, -0.1275510204, -0.2091836735, -0.2500000000, -0.2500000000,
+			 -0.2091836734, -0.1275510205, -0.0051020408}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.1093750000, -0.1875000000, -0.2343750000, -0.2500000000,
+			 -0.2343750000, -0.1875000000, -0.1093750000, 0.0000000000},
+			{-0.0039062500, -0.1132812500, -0.1914062500, -0.2382812500, -0.2539062500,
+			 -0.2382812500, -0.1914062500, -0.1132812500, -0.0039062500}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.0987654321, -0.1728395062, -0.2222222222, -0.2469135802,
+			 -0.2469135802, -0.2222222222, -0.1728395062, -0.0987654321, 0.0000000000},
+			{-0.0030864198, -0.1018518519, -0.1759259260, -0.2253086420, -0.2500000000,
+			 -0.2500000000, -0.2253086420, -0.1759259259, -0.1018518519, -0.0030864197}
+		}
+	}
+};
+
+// range/unirange-3_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL cubicSlefeBounds[maxBezierSlefeDivs + 1][2][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.3849001794, -0.3849001794}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.3849001794, -0.3849001794}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.3750000000, 0.0000000000},
+			{-0.1410563851, -0.5160563851, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3750000000, 0.0000000000},
+			{0.0000000000, -0.5160563852, -0.1410563852}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.3703703704, -0.2962962963, 0.0000000000},
+			{-0.0695214343, -0.4398918047, -0.3153515940, -0.0087327217}
+		},
+		{
+			{0.0000000000, -0.2962962963, -0.3703703704, 0.0000000000},
+			{-0.0087327217, -0.3153515940, -0.4398918047, -0.0695214343}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.3281250000, -0.3750000000, -0.2343750000, 0.0000000000},
+			{-0.0410388502, -0.3691638502, -0.3939762896, -0.2505638459, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2343750000, -0.3750000000, -0.3281250000, 0.0000000000},
+			{0.0000000000, -0.2505638459, -0.3939762896, -0.3691638502, -0.0410388502}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.2880000000, -0.3840000000, -0.3360000000, -0.1920000000, 0.0000000000},
+			{-0.0270092530, -0.3150092530, -0.3995286667, -0.3504788491, -0.1964418727, -0.0015891812}
+		},
+		{
+			{0.0000000000, -0.1920000000, -0.3360000000, -0.3840000000, -0.2880000000, 0.0000000000},
+			{-0.0015891812, -0.1964418727, -0.3504788491, -0.3995286667, -0.3150092530, -0.0270092530}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.2546296296, -0.3703703704, -0.3750000000, -0.2962962963,
+			 -0.1620370370, 0.0000000000},
+			{-0.0191016043, -0.2737312339, -0.3827658850, -0.3869147470, -0.3020995193,
+			 -0.1666505058, -0.0000003806}
+		},
+		{
+			{0.0000000000, -0.1620370370, -0.2962962963, -0.3750000000, -0.3703703704,
+			 -0.2546296296, 0.0000000000},
+			{-0.0000003806, -0.1666505058, -0.3020995193, -0.3869147470, -0.3827658850,
+			 -0.2737312339, -0.0191016043}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.2274052478, -0.3498542274, -0.3848396501, -0.3498542274,
+			 -0.2623906706, -0.1399416910, 0.0000000000},
+			{-0.0142151634, -0.2416204112, -0.3598206082, -0.3945554747, -0.3556153529,
+			 -0.2675629377, -0.1416263928, -0.0005239711}
+		},
+		{
+			{0.0000000000, -0.1399416910, -0.2623906706, -0.3498542274, -0.3848396501,
+			 -0.3498542274, -0.2274052478, 0.0000000000},
+			{-0.0005239711, -0.1416263928, -0.2675629377, -0.3556153529, -0.3945554747,
+			 -0.3598206082, -0.2416204112, -0.0142151634}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.2050781250, -0.3281250000, -0.3808593750, -0.3750000000,
+			 -0.3222656250, -0.2343750000, -0.1230468750, 0.0000000000},
+			{-0.0109876841, -0.2160658091, -0.3362541578, -0.3888453456, -0.3802903092,
+			 -0.3272298633, -0.2368701398, -0.1249469164, -0.0000037295}
+		},
+		{
+			{0.0000000000, -0.1230468750, -0.2343750000, -0.3222656250, -0.3750000000,
+			 -0.3808593750, -0.3281250000, -0.2050781250, 0.0000000000},
+			{-0.0000037296, -0.1249469164, -0.2368701398, -0.3272298633, -0.3802903092,
+			 -0.3888453456, -0.3362541578, -0.2160658091, -0.0109876841}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.1865569273, -0.3072702332, -0.3703703704, -0.3840877915,
+			 -0.3566529492, -0.2962962963, -0.2112482853, -0.1097393690, 0.0000000000},
+			{-0.0087456964, -0.1953026237, -0.3140019280, -0.3770143787, -0.3888154597,
+			 -0.3611851271, -0.2990387770, -0.2136498378, -0.1105527942, -0.0002300333}
+		},
+		{
+			{0.0000000000, -0.1097393690, -0.2112482853, -0.2962962963, -0.3566529492,
+			 -0.3840877915, -0.3703703704, -0.3072702332, -0.1865569273, 0.0000000000},
+			{-0.0002300333, -0.1105527942, -0.2136498378, -0.2990387770, -0.3611851271,
+			 -0.3888154597, -0.3770143787, -0.3140019280, -0.1953026237, -0.0087456964}
+		}
+	}
+};
+
+// range/unirange-4_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL quarticSlefeBounds[maxBezierSlefeDivs + 1][3][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.4724703936, -0.4724703936}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6250000000, -0.6250000000}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.4724703936, -0.4724703936}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.4375000000, 0.0000000000},
+			{-0.2173864279, -0.6548864279, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6250000000, 0.0000000000},
+			{-0.1345090003, -0.7595090003, -0.1345090003}
+		},
+		{
+			{0.0000000000, -0.4375000000, 0.0000000000},
+			{0.0000000000, -0.6548864279, -0.2173864279}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.4691358025, -0.3209876543, 0.0000000000},
+			{-0.1170222511, -0.5861580536, -0.3268206221, -0.0058329678}
+		},
+		{
+			{0.0000000000, -0.5432098765, -0.5432098765, 0.0000000000},
+			{-0.0455493875, -0.6250000000, -0.6250000000, -0.0455493874}
+		},
+		{
+			{0.0000000000, -0.3209876543, -0.4691358025, 0.0000000000},
+			{-0.0058329678, -0.3268206221, -0.5861580535, -0.1170222510}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.4335937500, -0.4375000000, -0.2460937500, 0.0000000000},
+			{-0.0721835129, -0.5057772629, -0.4510866518, -0.2596804016, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4453125000, -0.6250000000, -0.4453125000, 0.0000000000},
+			{-0.0025206899, -0.4887912114, -0.6684787114, -0.4887912114, -0.0025206899}
+		},
+		{
+			{0.0000000000, -0.2460937500, -0.4375000000, -0.4335937500, 0.0000000000},
+			{0.0000000000, -0.2596804016, -0.4510866518, -0.5057772629, -0.0721835129}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.3904000000, -0.4704000000, -0.3744000000, -0.1984000000, 0.0000000000},
+			{-0.0487664847, -0.4391664847, -0.4855660839, -0.3895660835, -0.1991559526, -0.0007559527}
+		},
+		{
+			{0.0000000000, -0.3712000000, -0.5952000000, -0.5952000000, -0.3712000000, 0.0000000000},
+			{-0.0006375681, -0.3962253461, -0.6250000000, -0.6250000000, -0.3962253461, -0.0006375681}
+		},
+		{
+			{0.0000000000, -0.1984000000, -0.3744000000, -0.4704000000, -0.3904000000, 0.0000000000},
+			{-0.0007559527, -0.1991559526, -0.3895660835, -0.4855660839, -0.4391664847, -0.0487664847}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.3510802469, -0.4691358025, -0.4375000000, -0.3209876543,
+			 -0.1658950617, 0.0000000000},
+			{-0.0350918908, -0.3861721377, -0.4833942743, -0.4517584715, -0.3236714374,
+			 -0.1685788448, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3163580247, -0.5432098765, -0.6250000000, -0.5432098765,
+			 -0.3163580247, 0.0000000000},
+			{-0.0019232241, -0.3276060826, -0.5633698923, -0.6451600158, -0.5633698922,
+			 -0.3276060825, -0.0019232242}
+		},
+		{
+			{0.0000000000, -0.1658950617, -0.3209876543, -0.4375000000, -0.4691358025,
+			 -0.3510802469, 0.0000000000},
+			{0.0000000000, -0.1685788446, -0.3236714375, -0.4517584715, -0.4833942743,
+			 -0.3861721378, -0.0350918909}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.3173677634, -0.4539775094, -0.4648063307, -0.3948354852,
+			 -0.2790503957, -0.1424406497, 0.0000000000},
+			{-0.0264386140, -0.3438063774, -0.4666718255, -0.4775006467, -0.3987833413,
+			 -0.2829982516, -0.1426374304, -0.0001967807}
+		},
+		{
+			{0.0000000000, -0.2748854644, -0.4914618909, -0.6097459392, -0.6097459392,
+			 -0.4914618909, -0.2748854644, 0.0000000000},
+			{-0.0014298308, -0.2817569619, -0.5054695559, -0.6250000000, -0.6250000000,
+			 -0.5054695559, -0.2817569619, -0.0014298308}
+		},
+		{
+			{0.0000000000, -0.1424406497, -0.2790503957, -0.3948354852, -0.4648063307,
+			 -0.4539775094, -0.3173677634, 0.0000000000},
+			{-0.0001967807, -0.1426374304, -0.2829982516, -0.3987833413, -0.4775006466,
+			 -0.4666718256, -0.3438063775, -0.0264386141}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.2888183594, -0.4335937500, -0.4724121094, -0.4375000000,
+			 -0.3552246094, -0.2460937500, -0.1247558594, 0.0000000000},
+			{-0.0206247865, -0.3094431459, -0.4446970434, -0.4835154031, -0.4420114694,
+			 -0.3597360791, -0.2469429158, -0.1256050250, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2426757813, -0.4453125000, -0.5786132813, -0.6250000000,
+			 -0.5786132813, -0.4453125000, -0.2426757813, 0.0000000000},
+			{-0.0004245076, -0.2483198241, -0.4539446184, -0.5901187310, -0.6365054498,
+			 -0.5901187311, -0.4539446182, -0.2483198244, -0.0004245074}
+		},
+		{
+			{0.0000000000, -0.1247558594, -0.2460937500, -0.3552246094, -0.4375000000,
+			 -0.4724121094, -0.4335937500, -0.2888183594, 0.0000000000},
+			{0.0000000000, -0.1256050249, -0.2469429159, -0.3597360791, -0.4420114694,
+			 -0.4835154031, -0.4446970434, -0.3094431459, -0.0206247865}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.2645938119, -0.4118274653, -0.4691358025, -0.4602956866,
+			 -0.4054260021, -0.3209876543, -0.2197835696, -0.1109586953, 0.0000000000},
+			{-0.0165339330, -0.2811277449, -0.4215026845, -0.4788110212, -0.4649411756,
+			 -0.4100714911, -0.3224323734, -0.2212282888, -0.1110307073, -0.0000720119}
+		},
+		{
+			{0.0000000000, -0.2170400854, -0.4054260021, -0.5432098765, -0.6157597927,
+			 -0.6157597927, -0.5432098765, -0.4054260021, -0.2170400854, 0.0000000000},
+			{-0.0002307830, -0.2212053456, -0.4115366445, -0.5519934963, -0.6250000000,
+			 -0.6250000000, -0.5519934962, -0.4115366445, -0.2212053456, -0.0002307830}
+		},
+		{
+			{0.0000000000, -0.1109586953, -0.2197835696, -0.3209876543, -0.4054260021,
+			 -0.4602956866, -0.4691358025, -0.4118274653, -0.2645938119, 0.0000000000},
+			{-0.0000720119, -0.1110307073, -0.2212282888, -0.3224323734, -0.4100714912,
+			 -0.4649411755, -0.4788110214, -0.4215026844, -0.2811277449, -0.0165339330}
+		}
+	}
+};
+
+// range/unirange-5_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL quinticSlefeBounds[maxBezierSlefeDivs + 1][4][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.5349922439, -0.5349922439}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.7935782275, -0.7935782275}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.7935782275, -0.7935782275}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.5349922439, -0.5349922439}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.4687500000, 0.0000000000},
+			{-0.2854244413, -0.7541744413, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7812500000, 0.0000000000},
+			{-0.2854244413, -1.0214862520, -0.0980873400}
+		},
+		{
+			{0.0000000000, -0.7812500000, 0.0000000000},
+			{-0.0980873400, -1.0214862520, -0.2402362521}
+		},
+		{
+			{0.0000000000, -0.4687500000, 0.0000000000},
+			{0.0000000000, -0.7541744413, -0.2854244413}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.5349794239, -0.3292181070, 0.0000000000},
+			{-0.1655550032, -0.7005344271, -0.3314197212, -0.0022016142}
+		},
+		{
+			{0.0000000000, -0.7407407407, -0.6172839506, 0.0000000000},
+			{-0.0916480222, -0.8432770675, -0.7198202774, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6172839506, -0.7407407407, 0.0000000000},
+			{0.0000000000, -0.7198202773, -0.8432770674, -0.0916480222}
+		},
+		{
+			{0.0000000000, -0.3292181070, -0.5349794239, 0.0000000000},
+			{-0.0022016142, -0.3314197212, -0.7005344270, -0.1655550031}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.5126953125, -0.4687500000, -0.2490234375, 0.0000000000},
+			{-0.1062742609, -0.6189695734, -0.4776695138, -0.2579429513, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6298828125, -0.7812500000, -0.4833984375, 0.0000000000},
+			{-0.0435068837, -0.6974867369, -0.8488539244, -0.5246839290, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4833984375, -0.7812500000, -0.6298828125, 0.0000000000},
+			{0.0000000000, -0.5246839290, -0.8488539244, -0.6974867369, -0.0435068837}
+		},
+		{
+			{0.0000000000, -0.2490234375, -0.4687500000, -0.5126953125, 0.0000000000},
+			{0.0000000000, -0.2579429513, -0.4776695138, -0.6189695734, -0.1062742609}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.4723200000, -0.5222400000, -0.3897600000, -0.1996800000, 0.0000000000},
+			{-0.0735741768, -0.5458941768, -0.5351135572, -0.4026335569, -0.1998511975, -0.0001711976}
+		},
+		{
+			{0.0000000000, -0.5350400000, -0.7852800000, -0.7027200000, -0.3929600000, 0.0000000000},
+			{-0.0238494750, -0.5785930206, -0.8288330206, -0.7400105841, -0.3981752081, -0.0009288263}
+		},
+		{
+			{0.0000000000, -0.3929600000, -0.7027200000, -0.7852800000, -0.5350400000, 0.0000000000},
+			{-0.0009288263, -0.3981752081, -0.7400105841, -0.8288330206, -0.5785930206, -0.0238494751}
+		},
+		{
+			{0.0000000000, -0.1996800000, -0.3897600000, -0.5222400000, -0.4723200000, 0.0000000000},
+			{-0.0001711974, -0.1998511976, -0.4026335569, -0.5351135572, -0.5458941766, -0.0735741766}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.4314557613, -0.5349794239, -0.4687500000, -0.3292181070,
+			 -0.1665380658, 0.0000000000},
+			{-0.0538211821, -0.4852769434, -0.5489743883, -0.4827449643, -0.3303926932,
+			 -0.1677126520, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4610339506, -0.7407407407, -0.7812500000, -0.6172839506,
+			 -0.3298611111, 0.0000000000},
+			{-0.0025778201, -0.4900396818, -0.7701037523, -0.8106130116, -0.6308859551,
+			 -0.3360965939, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3298611111, -0.6172839506, -0.7812500000, -0.7407407407,
+			 -0.4610339506, 0.0000000000},
+			{0.0000000000, -0.3360965937, -0.6308859552, -0.8106130115, -0.7701037522,
+			 -0.4900396817, -0.0025778200}
+		},
+		{
+			{0.0000000000, -0.1665380658, -0.3292181070, -0.4687500000, -0.5349794239,
+			 -0.4314557613, 0.0000000000},
+			{0.0000000000, -0.1677126518, -0.3303926933, -0.4827449643, -0.5489743883,
+			 -0.4852769435, -0.0538211822}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.3944784911, -0.5283512822, -0.5105015767, -0.4141131671,
+			 -0.2838103171, -0.1427976438, 0.0000000000},
+			{-0.0410309742, -0.4355094653, -0.5420312550, -0.5241815495, -0.4165068048,
+			 -0.2862039545, -0.1428294754, -0.0000318314}
+		},
+		{
+			{0.0000000000, -0.4034033438, -0.6848337002, -0.7925269233, -0.7318379247,
+			 -0.5438210270, -0.2838103171, 0.0000000000},
+			{-0.0011244226, -0.4234880026, -0.7073041658, -0.8149973889, -0.7509162026,
+			 -0.5507827503, -0.2879962060, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2838103171, -0.5438210270, -0.7318379247, -0.7925269233,
+			 -0.6848337002, -0.4034033438, 0.0000000000},
+			{0.0000000000, -0.2879962060, -0.5507827503, -0.7509162026, -0.8149973889,
+			 -0.7073041658, -0.4234880025, -0.0011244225}
+		},
+		{
+			{0.0000000000, -0.1427976438, -0.2838103171, -0.4141131671, -0.5105015767,
+			 -0.5283512822, -0.3944784911, 0.0000000000},
+			{-0.0000318316, -0.1428294753, -0.2862039545, -0.4165068048, -0.5241815493,
+			 -0.5420312551, -0.4355094654, -0.0410309743}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.3620910645, -0.5126953125, -0.5296325684, -0.4687500000,
+			 -0.3675842285, -0.2490234375, -0.1249694824, 0.0000000000},
+			{-0.0322937491, -0.3943848136, -0.5254673313, -0.5424045872, -0.4720710706,
+			 -0.3709052992, -0.2493021722, -0.1252482174, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3578186035, -0.6298828125, -0.7731628418, -0.7812500000,
+			 -0.6733703613, -0.4833984375, -0.2488708496, 0.0000000000},
+			{-0.0005309646, -0.3722273604, -0.6471111069, -0.7903911362, -0.7974223474,
+			 -0.6826757155, -0.4898622249, -0.2498611256, -0.0000474556}
+		},
+		{
+			{0.0000000000, -0.2488708496, -0.4833984375, -0.6733703613, -0.7812500000,
+			 -0.7731628418, -0.6298828125, -0.3578186035, 0.0000000000},
+			{-0.0000474553, -0.2498611258, -0.4898622246, -0.6826757155, -0.7974223474,
+			 -0.7903911362, -0.6471111069, -0.3722273604, -0.0005309648}
+		},
+		{
+			{0.0000000000, -0.1249694824, -0.2490234375, -0.3675842285, -0.4687500000,
+			 -0.5296325684, -0.5126953125, -0.3620910645, 0.0000000000},
+			{0.0000000000, -0.1252482171, -0.2493021724, -0.3709052992, -0.4720710706,
+			 -0.5424045872, -0.5254673313, -0.3943848136, -0.0322937491}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.3339599316, -0.4931497570, -0.5349794239, -0.5026334062,
+			 -0.4271029145, -0.3292181070, -0.2216802994, -0.1110941760, 0.0000000000},
+			{-0.0260681045, -0.3600280361, -0.5048283219, -0.5466579888, -0.5065271098,
+			 -0.4309966180, -0.3298994033, -0.2223615957, -0.1111032362, -0.0000090601}
+		},
+		{
+			{0.0000000000, -0.3210892648, -0.5796880557, -0.7407407407, -0.7935782147,
+			 -0.7458212671, -0.6172839506, -0.4338769497, -0.2215109485, 0.0000000000},
+			{-0.0013758278, -0.3291907530, -0.5930490582, -0.7541491239, -0.8069865979,
+			 -0.7555969669, -0.6246328587, -0.4370895089, -0.2227129287, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2215109485, -0.4338769497, -0.6172839506, -0.7458212671,
+			 -0.7935782147, -0.7407407407, -0.5796880557, -0.3210892648, 0.0000000000},
+			{0.0000000000, -0.2227129286, -0.4370895090, -0.6246328587, -0.7555969670,
+			 -0.8069865979, -0.7541491239, -0.5930490583, -0.3291907529, -0.0013758279}
+		},
+		{
+			{0.0000000000, -0.1110941760, -0.2216802994, -0.3292181070, -0.4271029145,
+			 -0.5026334062, -0.5349794239, -0.4931497570, -0.3339599316, 0.0000000000},
+			{-0.0000090600, -0.1111032362, -0.2223615959, -0.3298994032, -0.4309966179,
+			 -0.5065271099, -0.5466579890, -0.5048283218, -0.3600280361, -0.0260681045}
+		}
+	}
+};
+
+// range/unirange-6_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL sexticSlefeBounds[maxBezierSlefeDivs + 1][5][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.5823559323, -0.5823559323}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.9200868747, -0.9200868747}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.0312500000, -1.0312500000}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.0312500000, -0.9200868746}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.5823559324, -0.5823559324}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.4843750000, 0.0000000000},
+			{-0.3441062901, -0.8284812901, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.8750000000, 0.0000000000},
+			{-0.3506727450, -1.2256727450, -0.0642091995}
+		},
+		{
+			{0.0000000000, -1.0312500000, 0.0000000000},
+			{-0.1992224867, -1.2304724870, -0.1992224867}
+		},
+		{
+			{0.0000000000, -0.8750000000, 0.0000000000},
+			{-0.0642091995, -1.2256727450, -0.3506727451}
+		},
+		{
+			{0.0000000000, -0.4843750000, 0.0000000000},
+			{0.0000000000, -0.8284812901, -0.3441062901}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.5788751715, -0.3319615912, 0.0000000000},
+			{-0.2125320601, -0.7914072316, -0.3327604333, -0.0007988423}
+		},
+		{
+			{0.0000000000, -0.8943758573, -0.6474622771, 0.0000000000},
+			{-0.2125320601, -1.0430129970, -0.7527176787, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.8806584362, -0.8806584362, 0.0000000000},
+			{-0.0529928445, -1.0312500000, -1.0312500000, -0.0529928444}
+		},
+		{
+			{0.0000000000, -0.6474622771, -0.8943758573, 0.0000000000},
+			{0.0000000000, -0.7527176786, -1.0430129970, -0.1486371401}
+		},
+		{
+			{0.0000000000, -0.3319615912, -0.5788751715, 0.0000000000},
+			{-0.0007988423, -0.3327604333, -0.7914072315, -0.2125320600}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.5720214844, -0.4843750000, -0.2497558594, 0.0000000000},
+			{-0.1414330388, -0.7134545232, -0.4897516607, -0.2551325202, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7880859375, -0.8750000000, -0.4951171875, 0.0000000000},
+			{-0.0744278539, -0.8729139218, -0.9598279843, -0.4976868307, -0.0025696432}
+		},
+		{
+			{0.0000000000, -0.7075195313, -1.0312500000, -0.7075195313, 0.0000000000},
+			{0.0000000000, -0.7834482955, -1.1071787640, -0.7834482955, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4951171875, -0.8750000000, -0.7880859375, 0.0000000000},
+			{-0.0025696432, -0.4976868307, -0.9598279843, -0.8729139218, -0.0744278538}
+		},
+		{
+			{0.0000000000, -0.2497558594, -0.4843750000, -0.5720214844, 0.0000000000},
+			{0.0000000000, -0.2551325202, -0.4897516607, -0.7134545232, -0.1414330388}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.5378560000, -0.5533440000, -0.3959040000, -0.1999360000, 0.0000000000},
+			{-0.1001691243, -0.6380251243, -0.5632598958, -0.4058198958, -0.1999732707, -0.0000372710}
+		},
+		{
+			{0.0000000000, -0.6824960000, -0.9200640000, -0.7549440000, -0.3983360000, 0.0000000000},
+			{-0.0421205241, -0.7434058820, -0.9809738820, -0.7926012890, -0.3992150144, -0.0008790142}
+		},
+		{
+			{0.0000000000, -0.5813760000, -0.9757440000, -0.9757440000, -0.5813760000, 0.0000000000},
+			{0.0000000000, -0.6208362532, -1.0312500000, -1.0312500000, -0.6208362532, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3983360000, -0.7549440000, -0.9200640000, -0.6824960000, 0.0000000000},
+			{-0.0008790146, -0.3992150144, -0.7926012890, -0.9809738820, -0.7434058820, -0.0421205241}
+		},
+		{
+			{0.0000000000, -0.1999360000, -0.3959040000, -0.5533440000, -0.5378560000, 0.0000000000},
+			{-0.0000372710, -0.1999732707, -0.4058198958, -0.5632598958, -0.6380251243, -0.1001691243}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.4984353567, -0.5788751715, -0.4843750000, -0.3319615912,
+			 -0.1666452332, 0.0000000000},
+			{-0.0744263113, -0.5728616680, -0.5912917894, -0.4967916180, -0.3324336162,
+			 -0.1671172584, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5949931413, -0.8943758573, -0.8750000000, -0.6474622771,
+			 -0.3326474623, 0.0000000000},
+			{-0.0260282745, -0.6383945928, -0.9377773088, -0.9093676606, -0.6527131614,
+			 -0.3377001006, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4906121399, -0.8806584362, -1.0312500000, -0.8806584362,
+			 -0.4906121399, 0.0000000000},
+			{0.0000000000, -0.5002605173, -0.9172645563, -1.0678561200, -0.9172645563,
+			 -0.5002605171, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3326474623, -0.6474622771, -0.8750000000, -0.8943758573,
+			 -0.5949931413, 0.0000000000},
+			{0.0000000000, -0.3377001005, -0.6527131615, -0.9093676605, -0.9377773088,
+			 -0.6383945928, -0.0260282747}
+		},
+		{
+			{0.0000000000, -0.1666452332, -0.3319615912, -0.4843750000, -0.5788751715,
+			 -0.4984353567, 0.0000000000},
+			{0.0000000000, -0.1671172583, -0.3324336163, -0.4967916180, -0.5912917894,
+			 -0.5728616681, -0.0744263114}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.4605734005, -0.5814754057, -0.5366131459, -0.4223750308,
+			 -0.2851702947, -0.1428486430, 0.0000000000},
+			{-0.0573841158, -0.5179575163, -0.5947788978, -0.5499166383, -0.4236919640,
+			 -0.2864872278, -0.1428535930, -0.0000049498}
+		},
+		{
+			{0.0000000000, -0.5245773445, -0.8442060706, -0.9165568768, -0.7951788795,
+			 -0.5621807240, -0.2853912910, 0.0000000000},
+			{-0.0171677676, -0.5560483795, -0.8756771056, -0.9454724680, -0.8059344328,
+			 -0.5695164724, -0.2855625962, -0.0001713048}
+		},
+		{
+			{0.0000000000, -0.4233440148, -0.7881919948, -1.0027454550, -1.0027454550,
+			 -0.7881919948, -0.4233440148, 0.0000000000},
+			{-0.0003190133, -0.4277315233, -0.8122709819, -1.0312500000, -1.0312500000,
+			 -0.8122709816, -0.4277315236, -0.0003190133}
+		},
+		{
+			{0.0000000000, -0.2853912910, -0.5621807240, -0.7951788795, -0.9165568768,
+			 -0.8442060706, -0.5245773445, 0.0000000000},
+			{-0.0001713051, -0.2855625960, -0.5695164725, -0.8059344328, -0.9454724680,
+			 -0.8756771055, -0.5560483794, -0.0171677677}
+		},
+		{
+			{0.0000000000, -0.1428486430, -0.2851702947, -0.4223750308, -0.5366131459,
+			 -0.5814754057, -0.4605734005, 0.0000000000},
+			{-0.0000049498, -0.1428535930, -0.2864872278, -0.4236919640, -0.5499166384,
+			 -0.5947788978, -0.5179575164, -0.0573841159}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.4262046814, -0.5720214844, -0.5653953552, -0.4843750000,
+			 -0.3722190857, -0.2497558594, -0.1249961853, 0.0000000000},
+			{-0.0455527957, -0.4717574771, -0.5852677687, -0.5786416398, -0.4865848912,
+			 -0.3744289770, -0.2498398697, -0.1250801956, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4677276611, -0.7880859375, -0.9162139893, -0.8750000000,
+			 -0.7166290283, -0.4951171875, -0.2498321533, 0.0000000000},
+			{-0.0024296053, -0.4910733227, -0.8117711921, -0.9398992439, -0.8882101254,
+			 -0.7255904079, -0.4969078815, -0.2506622749, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3718643188, -0.7075195313, -0.9451675415, -1.0312500000,
+			 -0.9451675415, -0.7075195313, -0.3718643188, 0.0000000000},
+			{0.0000000000, -0.3768927189, -0.7190700929, -0.9663525588, -1.0524350170,
+			 -0.9663525588, -0.7190700929, -0.3768927190, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2498321533, -0.4951171875, -0.7166290283, -0.8750000000,
+			 -0.9162139893, -0.7880859375, -0.4677276611, 0.0000000000},
+			{0.0000000000, -0.2506622747, -0.4969078815, -0.7255904079, -0.8882101254,
+			 -0.9398992438, -0.8117711920, -0.4910733227, -0.0024296053}
+		},
+		{
+			{0.0000000000, -0.1249961853, -0.2497558594, -0.3722190857, -0.4843750000,
+			 -0.5653953552, -0.5720214844, -0.4262046814, 0.0000000000},
+			{0.0000000000, -0.1250801955, -0.2498398698, -0.3744289770, -0.4865848912,
+			 -0.5786416398, -0.5852677687, -0.4717574771, -0.0455527957}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.3956187046, -0.5564004283, -0.5788751715, -0.5261543614,
+			 -0.4367370978, -0.3319615912, -0.2221017949, -0.1111092294, 0.0000000000},
+			{-0.0370183307, -0.4326370353, -0.5691039717, -0.5915787150, -0.5290994534,
+			 -0.4396821896, -0.3322531305, -0.2223933340, -0.1111103252, -0.0000010959}
+		},
+		{
+			{0.0000000000, -0.4212847710, -0.7332968288, -0.8943758573, -0.9111829912,
+			 -0.8156690959, -0.6474622771, -0.4416746167, -0.2221281384, 0.0000000000},
+			{-0.0013290221, -0.4389960892, -0.7525837858, -0.9136628143, -0.9275875137,
+			 -0.8230046928, -0.6534881662, -0.4424373724, -0.2228908942, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3313406380, -0.6391189238, -0.8806584362, -1.0139601570,
+			 -1.0139601570, -0.8806584362, -0.6391189238, -0.3313406380, 0.0000000000},
+			{0.0000000000, -0.3349992290, -0.6462868782, -0.8962911881, -1.0312500000,
+			 -1.0312500000, -0.8962911885, -0.6462868779, -0.3349992292, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2221281384, -0.4416746167, -0.6474622771, -0.8156690959,
+			 -0.9111829912, -0.8943758573, -0.7332968288, -0.4212847710, 0.0000000000},
+			{0.0000000000, -0.2228908943, -0.4424373723, -0.6534881660, -0.8230046929,
+			 -0.9275875136, -0.9136628144, -0.7525837859, -0.4389960891, -0.0013290221}
+		},
+		{
+			{0.0000000000, -0.1111092294, -0.2221017949, -0.3319615912, -0.4367370978,
+			 -0.5261543614, -0.5788751715, -0.5564004283, -0.3956187046, 0.0000000000},
+			{-0.0000010959, -0.1111103252, -0.2223933341, -0.3322531304, -0.4396821897,
+			 -0.5290994533, -0.5915787150, -0.5691039717, -0.4326370352, -0.0370183306}
+		}
+	}
+};
+
+// range/unirange-7_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL septicSlefeBounds[maxBezierSlefeDivs + 1][6][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6197314513, -0.6197314513}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.0193009690, -1.0193009690}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.2162080700, -1.2162080700}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.2162080700, -1.2162080700}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.2162080700, -1.0193009700}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6197314514, -0.6197314514}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.4921875000, 0.0000000000},
+			{-0.3942026772, -0.8863901772, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9296875000, 0.0000000000},
+			{-0.4571714030, -1.3868589030, -0.0396290396}
+		},
+		{
+			{0.0000000000, -1.2031250000, 0.0000000000},
+			{-0.4571714030, -1.5239106710, -0.1461921471}
+		},
+		{
+			{0.0000000000, -1.2031250000, 0.0000000000},
+			{-0.1461921472, -1.5239106720, -0.3207856721}
+		},
+		{
+			{0.0000000000, -0.9296875000, 0.0000000000},
+			{-0.0396290395, -1.3868589030, -0.4571714030}
+		},
+		{
+			{0.0000000000, -0.4921875000, 0.0000000000},
+			{0.0000000000, -0.8863901772, -0.3942026772}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.6081390032, -0.3328760860, 0.0000000000},
+			{-0.2566552414, -0.8647942446, -0.3331594565, -0.0002833707}
+		},
+		{
+			{0.0000000000, -1.0114311840, -0.6593507087, 0.0000000000},
+			{-0.2566552414, -1.2239525850, -0.7559457754, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.1074531320, -0.9474165524, 0.0000000000},
+			{-0.0971404186, -1.2836325010, -1.1235959210, -0.0268247183}
+		},
+		{
+			{0.0000000000, -0.9474165524, -1.1074531320, 0.0000000000},
+			{-0.0268247184, -1.1235959200, -1.2836325000, -0.0971404186}
+		},
+		{
+			{0.0000000000, -0.6593507087, -1.0114311840, 0.0000000000},
+			{0.0000000000, -0.7559457751, -1.2239525850, -0.2125214007}
+		},
+		{
+			{0.0000000000, -0.3328760860, -0.6081390032, 0.0000000000},
+			{-0.0002833702, -0.3331594567, -0.8647942446, -0.2566552414}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.6165161133, -0.4921875000, -0.2499389648, 0.0000000000},
+			{-0.1764230603, -0.7929391736, -0.4952672085, -0.2530186731, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9215698242, -0.9296875000, -0.4985961914, 0.0000000000},
+			{-0.1764230603, -1.0334021810, -1.0236179740, -0.4994031618, -0.0008069703}
+		},
+		{
+			{0.0000000000, -0.9151611328, -1.2031250000, -0.7357177734, 0.0000000000},
+			{-0.0375127818, -1.0247175520, -1.3126814190, -0.8036293401, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7357177734, -1.2031250000, -0.9151611328, 0.0000000000},
+			{0.0000000000, -0.8036293401, -1.3126814180, -1.0247175510, -0.0375127818}
+		},
+		{
+			{0.0000000000, -0.4985961914, -0.9296875000, -0.9215698242, 0.0000000000},
+			{-0.0008069703, -0.4994031618, -1.0236179750, -1.0334021810, -0.1118323572}
+		},
+		{
+			{0.0000000000, -0.2499389648, -0.4921875000, -0.6165161133, 0.0000000000},
+			{0.0000000000, -0.2530186728, -0.4952672087, -0.7929391735, -0.1764230602}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.5902848000, -0.5720064000, -0.3983616000, -0.1999872000, 0.0000000000},
+			{-0.1276215182, -0.7179063182, -0.5791911042, -0.4055463042, -0.1999951326, -0.0000079325}
+		},
+		{
+			{0.0000000000, -0.8135680000, -1.0133760000, -0.7795200000, -0.3996160000, 0.0000000000},
+			{-0.0652381899, -0.8884346576, -1.0882426580, -0.7861661598, -0.4062621594, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7616000000, -1.1934720000, -1.0832640000, -0.5949440000, 0.0000000000},
+			{0.0000000000, -0.8253222540, -1.2582983420, -1.1480903420, -0.5982874056, -0.0014706978}
+		},
+		{
+			{0.0000000000, -0.5949440000, -1.0832640000, -1.1934720000, -0.7616000000, 0.0000000000},
+			{-0.0014706978, -0.5982874054, -1.1480903420, -1.2582983420, -0.8253222550, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3996160000, -0.7795200000, -1.0133760000, -0.8135680000, 0.0000000000},
+			{0.0000000000, -0.4062621591, -0.7861661599, -1.0882426580, -0.8884346576, -0.0652381898}
+		},
+		{
+			{0.0000000000, -0.1999872000, -0.3983616000, -0.5720064000, -0.5902848000, 0.0000000000},
+			{-0.0000079325, -0.1999951326, -0.4055463042, -0.5791911041, -0.7179063184, -0.1276215184}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.5542516861, -0.6081390032, -0.4921875000, -0.3328760860,
+			 -0.1666630944, 0.0000000000},
+			{-0.0962305485, -0.6504822346, -0.6184646326, -0.5025131296, -0.3330563341,
+			 -0.1668433426, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7177890661, -1.0114311840, -0.9296875000, -0.6593507087,
+			 -0.3332011603, 0.0000000000},
+			{-0.0411426297, -0.7747665328, -1.0684086510, -0.9650408486, -0.6617560333,
+			 -0.3356064848, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6468978624, -1.1074531320, -1.2031250000, -0.9474165524,
+			 -0.4978637974, 0.0000000000},
+			{0.0000000000, -0.6849985580, -1.1571260700, -1.2527979380, -0.9832236034,
+			 -0.4989831399, -0.0011193421}
+		},
+		{
+			{0.0000000000, -0.4978637974, -0.9474165524, -1.2031250000, -1.1074531320,
+			 -0.6468978624, 0.0000000000},
+			{-0.0011193428, -0.4989831396, -0.9832236034, -1.2527979380, -1.1571260700,
+			 -0.6849985580, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3332011603, -0.6593507087, -0.9296875000, -1.0114311840,
+			 -0.7177890661, 0.0000000000},
+			{0.0000000000, -0.3356064846, -0.6617560333, -0.9650408483, -1.0684086510,
+			 -0.7747665331, -0.0411426299}
+		},
+		{
+			{0.0000000000, -0.1666630944, -0.3328760860, -0.4921875000, -0.6081390032,
+			 -0.5542516861, 0.0000000000},
+			{0.0000000000, -0.1668433426, -0.3330563341, -0.5025131297, -0.6184646325,
+			 -0.6504822349, -0.0962305488}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.5172261801, -0.6194212081, -0.5515340425, -0.4259158295,
+			 -0.2855588597, -0.1428559286, 0.0000000000},
+			{-0.0750012447, -0.5922274248, -0.6315279604, -0.5636407949, -0.4265974030,
+			 -0.2862404330, -0.1428566812, -0.0000007523}
+		},
+		{
+			{0.0000000000, -0.6378829035, -0.9732217990, -0.9986218085, -0.8270460680,
+			 -0.5683977643, -0.2856608580, 0.0000000000},
+			{-0.0275351604, -0.6811094451, -1.0164483410, -1.0312682120, -0.8328617080,
+			 -0.5742134039, -0.2856917607, -0.0000309024}
+		},
+		{
+			{0.0000000000, -0.5602548987, -1.0082776490, -1.2107054520, -1.1290339420,
+			 -0.8308370055, -0.4275478026, 0.0000000000},
+			{0.0000000000, -0.5840396554, -1.0442507500, -1.2466785530, -1.1623077450,
+			 -0.8401797231, -0.4316239931, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4275478026, -0.8308370055, -1.1290339420, -1.2107054520,
+			 -1.0082776490, -0.5602548987, 0.0000000000},
+			{0.0000000000, -0.4316239937, -0.8401797226, -1.1623077460, -1.2466785540,
+			 -1.0442507510, -0.5840396554, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2856608580, -0.5683977643, -0.8270460680, -0.9986218085,
+			 -0.9732217990, -0.6378829035, 0.0000000000},
+			{-0.0000309031, -0.2856917604, -0.5742134040, -0.8328617079, -1.0312682120,
+			 -1.0164483410, -0.6811094450, -0.0275351607}
+		},
+		{
+			{0.0000000000, -0.1428559286, -0.2855588597, -0.4259158295, -0.5515340425,
+			 -0.6194212081, -0.5172261801, 0.0000000000},
+			{-0.0000007523, -0.1428566812, -0.2862404333, -0.4265974028, -0.5636407949,
+			 -0.6315279604, -0.5922274247, -0.0750012446}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.4823040962, -0.6165161133, -0.5877470970, -0.4921875000,
+			 -0.3739571571, -0.2499389648, -0.1249995232, 0.0000000000},
+			{-0.0600303839, -0.5423344801, -0.6293613411, -0.6005923245, -0.4935658053,
+			 -0.3753354621, -0.2499630251, -0.1250235833, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5719122887, -0.9215698242, -1.0190320010, -0.9296875000,
+			 -0.7357478142, -0.4985961914, -0.2499756813, 0.0000000000},
+			{-0.0193022368, -0.6050525536, -0.9547100891, -1.0475758160, -0.9388982696,
+			 -0.7436305612, -0.4990642543, -0.2504437443, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4932222366, -0.9151611328, -1.1686849590, -1.2031250000,
+			 -1.0367059710, -0.7357177734, -0.3744611740, 0.0000000000},
+			{-0.0000013760, -0.4999800464, -0.9410131468, -1.1964562550, -1.2308962960,
+			 -1.0583878290, -0.7399838096, -0.3775787811, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3744611740, -0.7357177734, -1.0367059710, -1.2031250000,
+			 -1.1686849590, -0.9151611328, -0.4932222366, 0.0000000000},
+			{0.0000000000, -0.3775787806, -0.7399838102, -1.0583878280, -1.2308962950,
+			 -1.1964562540, -0.9410131478, -0.4999800459, -0.0000013760}
+		},
+		{
+			{0.0000000000, -0.2499756813, -0.4985961914, -0.7357478142, -0.9296875000,
+			 -1.0190320010, -0.9215698242, -0.5719122887, 0.0000000000},
+			{0.0000000000, -0.2504437442, -0.4990642543, -0.7436305620, -0.9388982688,
+			 -1.0475758170, -0.9547100891, -0.6050525536, -0.0193022368}
+		},
+		{
+			{0.0000000000, -0.1249995232, -0.2499389648, -0.3739571571, -0.4921875000,
+			 -0.5877470970, -0.6165161133, -0.4823040962, 0.0000000000},
+			{0.0000000000, -0.1250235836, -0.2499630249, -0.3753354621, -0.4935658053,
+			 -0.6005923245, -0.6293613411, -0.5423344802, -0.0600303840}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.4504265029, -0.6055953948, -0.6081390032, -0.5392215588,
+			 -0.4410189571, -0.3328760860, -0.2221954606, -0.1111109020, 0.0000000000},
+			{-0.0491010935, -0.4995275964, -0.6185092878, -0.6210528962, -0.5413061283,
+			 -0.4431035265, -0.3329934409, -0.2223128155, -0.1111110316, -0.0000001296}
+		},
+		{
+			{0.0000000000, -0.5171984180, -0.8668260238, -1.0114311840, -0.9869727360,
+			 -0.8520648994, -0.6593507087, -0.4437352615, -0.2222100959, 0.0000000000},
+			{-0.0140407269, -0.5429787049, -0.8926063107, -1.0358240770, -0.9984837829,
+			 -0.8608935817, -0.6608054662, -0.4451900191, -0.2222171213, -0.0000070253}
+		},
+		{
+			{0.0000000000, -0.4400998627, -0.8328868533, -1.1074531320, -1.2151949970,
+			 -1.1507120370, -0.9474165524, -0.6583906356, -0.3330282927, 0.0000000000},
+			{-0.0001819967, -0.4438957290, -0.8516338768, -1.1297027020, -1.2374445670,
+			 -1.1708903600, -0.9563739021, -0.6640301624, -0.3331893329, -0.0001610403}
+		},
+		{
+			{0.0000000000, -0.3330282927, -0.6583906356, -0.9474165524, -1.1507120370,
+			 -1.2151949970, -1.1074531320, -0.8328868533, -0.4400998627, 0.0000000000},
+			{-0.0001610402, -0.3331893330, -0.6640301614, -0.9563739033, -1.1708903580,
+			 -1.2374445670, -1.1297027020, -0.8516338768, -0.4438957290, -0.0001819966}
+		},
+		{
+			{0.0000000000, -0.2222100959, -0.4437352615, -0.6593507087, -0.8520648994,
+			 -0.9869727360, -1.0114311840, -0.8668260238, -0.5171984180, 0.0000000000},
+			{-0.0000070253, -0.2222171213, -0.4451900192, -0.6608054662, -0.8608935817,
+			 -0.9984837828, -1.0358240770, -0.8926063107, -0.5429787049, -0.0140407268}
+		},
+		{
+			{0.0000000000, -0.1111109020, -0.2221954606, -0.3328760860, -0.4410189571,
+			 -0.5392215588, -0.6081390032, -0.6055953948, -0.4504265029, 0.0000000000},
+			{-0.0000001295, -0.1111110316, -0.2223128154, -0.3329934410, -0.4431035268,
+			 -0.5413061281, -0.6210528962, -0.6185092878, -0.4995275964, -0.0491010935}
+		}
+	}
+};
+
+// range/unirange-8_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL octicSlefeBounds[maxBezierSlefeDivs + 1][7][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6501225015, -0.6501225015}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.0996151080, -1.0996151080}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.3651844220, -1.3651844220}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.4531250000, -1.4531250000}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.4531250000, -1.3651844210}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.4531250000, -1.0996151080}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6501225015, -0.6501225015}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.4960937500, 0.0000000000},
+			{-0.4369922931, -0.9330860431, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9609375000, 0.0000000000},
+			{-0.5555804015, -1.5165179020, -0.0235634183}
+		},
+		{
+			{0.0000000000, -1.3164062500, 0.0000000000},
+			{-0.5555804015, -1.7676326260, -0.0999934670}
+		},
+		{
+			{0.0000000000, -1.4531250000, 0.0000000000},
+			{-0.2578559524, -1.7109809520, -0.2578559524}
+		},
+		{
+			{0.0000000000, -1.3164062500, 0.0000000000},
+			{-0.0999934670, -1.7676326260, -0.4512263758}
+		},
+		{
+			{0.0000000000, -0.9609375000, 0.0000000000},
+			{-0.0235634183, -1.5165179020, -0.5555804015}
+		},
+		{
+			{0.0000000000, -0.4960937500, 0.0000000000},
+			{0.0000000000, -0.9330860432, -0.4369922932}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.6276482244, -0.3331809175, 0.0000000000},
+			{-0.2973862120, -0.9250344364, -0.3332800065, -0.0000990889}
+		},
+		{
+			{0.0000000000, -1.0992226790, -0.6639231824, 0.0000000000},
+			{-0.2973862120, -1.3791149240, -0.7465733531, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.2976680380, -0.9775948788, 0.0000000000},
+			{-0.1536117296, -1.4783678400, -1.1582946810, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.2229843010, -1.2229843010, 0.0000000000},
+			{-0.0549136686, -1.4531250000, -1.4531250000, -0.0549136686}
+		},
+		{
+			{0.0000000000, -0.9775948788, -1.2976680380, 0.0000000000},
+			{0.0000000000, -1.1582946810, -1.4783678400, -0.1536117299}
+		},
+		{
+			{0.0000000000, -0.6639231824, -1.0992226790, 0.0000000000},
+			{0.0000000000, -0.7465733526, -1.3791149250, -0.2798922456}
+		},
+		{
+			{0.0000000000, -0.3331809175, -0.6276482244, 0.0000000000},
+			{-0.0000990891, -0.3332800064, -0.9250344363, -0.2973862119}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.6498870850, -0.4960937500, -0.2499847412, 0.0000000000},
+			{-0.2104574159, -0.8603445009, -0.4978007510, -0.2516917426, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.0328063960, -0.9609375000, -0.4996032715, 0.0000000000},
+			{-0.2104574159, -1.1870223650, -1.0568182540, -0.4998465558, -0.0002432845}
+		},
+		{
+			{0.0000000000, -1.1042633060, -1.3164062500, -0.7453765869, 0.0000000000},
+			{-0.0629838490, -1.2409267520, -1.4530696960, -0.7985923459, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9680786133, -1.4531250000, -0.9680786133, 0.0000000000},
+			{0.0000000000, -1.0785097980, -1.5635561850, -1.0785097980, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7453765869, -1.3164062500, -1.1042633060, 0.0000000000},
+			{0.0000000000, -0.7985923449, -1.4530696970, -1.2409267530, -0.0629838486}
+		},
+		{
+			{0.0000000000, -0.4996032715, -0.9609375000, -1.0328063960, 0.0000000000},
+			{-0.0002432844, -0.4998465559, -1.0568182530, -1.1870223660, -0.1542159698}
+		},
+		{
+			{0.0000000000, -0.2499847412, -0.4960937500, -0.6498870850, 0.0000000000},
+			{0.0000000000, -0.2516917423, -0.4978007512, -0.8603445008, -0.2104574158}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.6322278400, -0.5832038400, -0.3993446400, -0.1999974400, 0.0000000000},
+			{-0.1552564284, -0.7874842684, -0.5881987863, -0.4043395865, -0.1999991043, -0.0000016644}
+		},
+		{
+			{0.0000000000, -0.9289113600, -1.0768281600, -0.7908249600, -0.3999129600, 0.0000000000},
+			{-0.1552564284, -1.0215050150, -1.1613303350, -0.7942778252, -0.4033658254, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9319936000, -1.3614336000, -1.1410176000, -0.5986816000, 0.0000000000},
+			{-0.0299986823, -1.0205835760, -1.4500235760, -1.2064738570, -0.5994340590, -0.0007524590}
+		},
+		{
+			{0.0000000000, -0.7882752000, -1.3673472000, -1.3673472000, -0.7882752000, 0.0000000000},
+			{0.0000000000, -0.8402881250, -1.4531250000, -1.4531250000, -0.8402881250, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5986816000, -1.1410176000, -1.3614336000, -0.9319936000, 0.0000000000},
+			{-0.0007524587, -0.5994340591, -1.2064738570, -1.4500235760, -1.0205835760, -0.0299986822}
+		},
+		{
+			{0.0000000000, -0.3999129600, -0.7908249600, -1.0768281600, -0.9289113600, 0.0000000000},
+			{0.0000000000, -0.4033658254, -0.7942778252, -1.1613303350, -1.0215050150, -0.0925936547}
+		},
+		{
+			{0.0000000000, -0.1999974400, -0.3993446400, -0.5832038400, -0.6322278400, 0.0000000000},
+			{-0.0000016644, -0.1999991043, -0.4043395865, -0.5881987863, -0.7874842684, -0.1552564284}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.6007652940, -0.6276482244, -0.4960937500, -0.3331809175,
+			 -0.1666660713, 0.0000000000},
+			{-0.1187072939, -0.7194725879, -0.6358599448, -0.5043054707, -0.3332475221,
+			 -0.1667326758, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.8294217250, -1.0992226790, -0.9609375000, -0.6639231824,
+			 -0.3333083276, 0.0000000000},
+			{-0.0595494583, -0.8979937020, -1.1677946560, -0.9700190694, -0.6730047519,
+			 -0.3333237233, -0.0000153953}
+		},
+		{
+			{0.0000000000, -0.7976019519, -1.2976680380, -1.3164062500, -0.9775948788,
+			 -0.4995338220, 0.0000000000},
+			{0.0000000000, -0.8543079549, -1.3557014570, -1.3744396690, -0.9864652493,
+			 -0.5042963376, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6615916971, -1.2229843010, -1.4531250000, -1.2229843010,
+			 -0.6615916971, 0.0000000000},
+			{-0.0001450091, -0.6663018518, -1.2781693780, -1.5083100770, -1.2781693780,
+			 -0.6663018520, -0.0001450092}
+		},
+		{
+			{0.0000000000, -0.4995338220, -0.9775948788, -1.3164062500, -1.2976680380,
+			 -0.7976019519, 0.0000000000},
+			{0.0000000000, -0.5042963383, -0.9864652488, -1.3744396700, -1.3557014580,
+			 -0.8543079549, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3333083276, -0.6639231824, -0.9609375000, -1.0992226790,
+			 -0.8294217250, 0.0000000000},
+			{-0.0000153955, -0.3333237232, -0.6730047517, -0.9700190695, -1.1677946560,
+			 -0.8979937024, -0.0595494581}
+		},
+		{
+			{0.0000000000, -0.1666660713, -0.3331809175, -0.4960937500, -0.6276482244,
+			 -0.6007652940, 0.0000000000},
+			{0.0000000000, -0.1667326758, -0.3332475221, -0.5043054704, -0.6358599450,
+			 -0.7194725878, -0.1187072938}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.5657857054, -0.6465253527, -0.5600602692, -0.4274333147,
+			 -0.2856698783, -0.1428569694, 0.0000000000},
+			{-0.0934784083, -0.6592641137, -0.6570455843, -0.5705805011, -0.4277717743,
+			 -0.2860083374, -0.1428570822, -0.0000001127}
+		},
+		{
+			{0.0000000000, -0.7430952083, -1.0762175490, -1.0519107250, -0.8427267481,
+			 -0.5704516080, -0.2857056124, 0.0000000000},
+			{-0.0404213455, -0.7974770906, -1.1305994310, -1.0857004070, -0.8461513651,
+			 -0.5738762242, -0.2857109580, -0.0000053456}
+		},
+		{
+			{0.0000000000, -0.6937935932, -1.2023433250, -1.3647104210, -1.2013674020,
+			 -0.8474620373, -0.4283794011, 0.0000000000},
+			{0.0000000000, -0.7308855595, -1.2485333790, -1.4109004750, -1.2348084960,
+			 -0.8505485660, -0.4314659301, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5689549388, -1.0856159650, -1.4089339770, -1.4089339770,
+			 -1.0856159650, -0.5689549388, 0.0000000000},
+			{-0.0012888635, -0.5702438025, -1.1200150210, -1.4531250000, -1.4531250000,
+			 -1.1200150210, -0.5702438025, -0.0012888633}
+		},
+		{
+			{0.0000000000, -0.4283794011, -0.8474620373, -1.2013674020, -1.3647104210,
+			 -1.2023433250, -0.6937935932, 0.0000000000},
+			{0.0000000000, -0.4314659296, -0.8505485662, -1.2348084970, -1.4109004760,
+			 -1.2485333800, -0.7308855589, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2857056124, -0.5704516080, -0.8427267481, -1.0519107250,
+			 -1.0762175490, -0.7430952083, 0.0000000000},
+			{-0.0000053453, -0.2857109580, -0.5738762243, -0.8461513650, -1.0857004070,
+			 -1.1305994310, -0.7974770899, -0.0404213459}
+		},
+		{
+			{0.0000000000, -0.1428569694, -0.2856698783, -0.4274333147, -0.5600602692,
+			 -0.6465253527, -0.5657857054, 0.0000000000},
+			{-0.0000001127, -0.1428570822, -0.2860083377, -0.4277717740, -0.5705805010,
+			 -0.6570455844, -0.6592641138, -0.0934784084}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.5313910842, -0.6498870850, -0.6017169356, -0.4960937500,
+			 -0.3746089339, -0.2499847412, -0.1249999404, 0.0000000000},
+			{-0.0754150331, -0.6068061173, -0.6617712182, -0.6136010688, -0.4969158493,
+			 -0.3754310332, -0.2499914092, -0.1250066083, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6700862646, -1.0328063960, -1.0916751620, -0.9609375000,
+			 -0.7440036535, -0.4996032715, -0.2499965429, 0.0000000000},
+			{-0.0286392105, -0.7131536956, -1.0758738270, -1.1231826200, -0.9670357605,
+			 -0.7501019139, -0.4997558296, -0.2501491016, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.6124334931, -1.1042633060, -1.3469401000, -1.3164062500,
+			 -1.0829821230, -0.7453765869, -0.3749113679, 0.0000000000},
+			{0.0000000000, -0.6374170289, -1.1397265920, -1.3824033860, -1.3476956320,
+			 -1.0919503970, -0.7514504785, -0.3749623757, -0.0000510078}
+		},
+		{
+			{0.0000000000, -0.4986813068, -0.9680786133, -1.3205730920, -1.4531250000,
+			 -1.3205730920, -0.9680786133, -0.4986813068, 0.0000000000},
+			{0.0000000000, -0.5025217689, -0.9803548637, -1.3529427800, -1.4854946880,
+			 -1.3529427800, -0.9803548637, -0.5025217691, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3749113679, -0.7453765869, -1.0829821230, -1.3164062500,
+			 -1.3469401000, -1.1042633060, -0.6124334931, 0.0000000000},
+			{-0.0000510078, -0.3749623757, -0.7514504786, -1.0919503970, -1.3476956320,
+			 -1.3824033860, -1.1397265920, -0.6374170286, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2499965429, -0.4996032715, -0.7440036535, -0.9609375000,
+			 -1.0916751620, -1.0328063960, -0.6700862646, 0.0000000000},
+			{0.0000000000, -0.2501491013, -0.4997558298, -0.7501019137, -0.9670357605,
+			 -1.1231826200, -1.0758738280, -0.7131536961, -0.0286392105}
+		},
+		{
+			{0.0000000000, -0.1249999404, -0.2499847412, -0.3746089339, -0.4960937500,
+			 -0.6017169356, -0.6498870850, -0.5313910842, 0.0000000000},
+			{0.0000000000, -0.1250066083, -0.2499914092, -0.3754310332, -0.4969158493,
+			 -0.6136010687, -0.6617712183, -0.6068061172, -0.0754150330}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.4991445458, -0.6438581466, -0.6276482244, -0.5464811129,
+			 -0.4429220056, -0.3331809175, -0.2222162752, -0.1111110879, 0.0000000000},
+			{-0.0620732832, -0.5612178290, -0.6563767404, -0.6401668186, -0.5478899785,
+			 -0.4443308711, -0.3332262439, -0.2222616015, -0.1111111030, -0.0000000151}
+		},
+		{
+			{0.0000000000, -0.6085447484, -0.9816142791, -1.0992226790, -1.0348857930,
+			 -0.8706196228, -0.6639231824, -0.4442660336, -0.2222206890, 0.0000000000},
+			{-0.0210066972, -0.6428869719, -1.0159565030, -1.1274655980, -1.0431328810,
+			 -0.8788272118, -0.6645903933, -0.4449332450, -0.2222216352, -0.0000009462}
+		},
+		{
+			{0.0000000000, -0.5474318009, -1.0132683970, -1.2976680380, -1.3606764610,
+			 -1.2317105410, -0.9775948788, -0.6642759619, -0.3332886609, 0.0000000000},
+			{0.0000000000, -0.5562909483, -1.0402737740, -1.3248607980, -1.3878692210,
+			 -1.2456066660, -0.9860191996, -0.6651946057, -0.3338831047, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4436905659, -0.8700070791, -1.2229843010, -1.4262847110,
+			 -1.4262847110, -1.2229843010, -0.8700070791, -0.4436905659, 0.0000000000},
+			{0.0000000000, -0.4467645659, -0.8764412663, -1.2460805550, -1.4531250000,
+			 -1.4531250000, -1.2460805550, -0.8764412663, -0.4467645660, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.3332886609, -0.6642759619, -0.9775948788, -1.2317105410,
+			 -1.3606764610, -1.2976680380, -1.0132683970, -0.5474318009, 0.0000000000},
+			{0.0000000000, -0.3338831047, -0.6651946057, -0.9860191997, -1.2456066660,
+			 -1.3878692210, -1.3248607980, -1.0402737750, -0.5562909476, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2222206890, -0.4442660336, -0.6639231824, -0.8706196228,
+			 -1.0348857930, -1.0992226790, -0.9816142791, -0.6085447484, 0.0000000000},
+			{-0.0000009461, -0.2222216352, -0.4449332450, -0.6645903933, -0.8788272130,
+			 -1.0431328800, -1.1274655990, -1.0159565030, -0.6428869718, -0.0210066970}
+		},
+		{
+			{0.0000000000, -0.1111110879, -0.2222162752, -0.3331809175, -0.4429220056,
+			 -0.5464811129, -0.6276482244, -0.6438581466, -0.4991445458, 0.0000000000},
+			{-0.0000000150, -0.1111111030, -0.2222616014, -0.3332262440, -0.4443308711,
+			 -0.5478899785, -0.6401668185, -0.6563767404, -0.5612178288, -0.0620732830}
+		}
+	}
+};
+
+// range/unirange-9_<divs>.asc: [divs][second difference][upper, lower bound][break point]
+static constexpr REAL nonicSlefeBounds[maxBezierSlefeDivs + 1][8][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6754094982, -0.6754094982}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.1662116720, -1.1662116720}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.4882778260, -1.4882778260}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.6480332440, -1.6480332440}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.6480332440, -1.6480332440}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.6480332440, -1.4882778260}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-1.6480332440, -1.1662116720}
+		},
+		{
+			{0.0000000000, 0.0000000000},
+			{-0.6754094982, -0.6754094982}
+		}
+	},
+	{ // 2
+		{
+			{0.0000000000, -0.4980468750, 0.0000000000},
+			{-0.4737484619, -0.9717953369, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9785156250, 0.0000000000},
+			{-0.6445012353, -1.6230168600, -0.0136535659}
+		},
+		{
+			{0.0000000000, -1.3886718750, 0.0000000000},
+			{-0.6445012353, -1.9706424200, -0.0652765951}
+		},
+		{
+			{0.0000000000, -1.6347656250, 0.0000000000},
+			{-0.6445012353, -2.0250674590, -0.1919752930}
+		},
+		{
+			{0.0000000000, -1.6347656250, 0.0000000000},
+			{-0.1919752940, -2.0250674590, -0.3903018344}
+		},
+		{
+			{0.0000000000, -1.3886718750, 0.0000000000},
+			{-0.0652765941, -1.9706424210, -0.5819705461}
+		},
+		{
+			{0.0000000000, -0.9785156250, 0.0000000000},
+			{-0.0136535659, -1.6230168600, -0.6445012353}
+		},
+		{
+			{0.0000000000, -0.4980468750, 0.0000000000},
+			{0.0000000000, -0.9717953370, -0.4737484620}
+		}
+	},
+	{ // 3
+		{
+			{0.0000000000, -0.6406543718, -0.3332825281, 0.0000000000},
+			{-0.3346194816, -0.9752738534, -0.3333168423, -0.0000343148}
+		},
+		{
+			{0.0000000000, -1.1642534170, -0.6656505614, 0.0000000000},
+			{-0.3481200978, -1.5123735150, -0.7331262413, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.4537418080, -0.9907026368, 0.0000000000},
+			{-0.3481200978, -1.6737861270, -1.1610296450, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.4701011020, -1.2816135750, 0.0000000000},
+			{-0.0953638421, -1.7296971490, -1.5412096220, -0.0284322135}
+		},
+		{
+			{0.0000000000, -1.2816135750, -1.4701011020, 0.0000000000},
+			{-0.0284322133, -1.5412096220, -1.7296971490, -0.0953638424}
+		},
+		{
+			{0.0000000000, -0.9907026368, -1.4537418080, 0.0000000000},
+			{0.0000000000, -1.1610296450, -1.6737861250, -0.2200443171}
+		},
+		{
+			{0.0000000000, -0.6656505614, -1.1642534170, 0.0000000000},
+			{0.0000000000, -0.7331262425, -1.5123735140, -0.3481200974}
+		},
+		{
+			{0.0000000000, -0.3332825281, -0.6406543718, 0.0000000000},
+			{-0.0000343145, -0.3333168424, -0.9752738533, -0.3346194815}
+		}
+	},
+	{ // 4
+		{
+			{0.0000000000, -0.6749153137, -0.4980468750, -0.2499961853, 0.0000000000},
+			{-0.2430616558, -0.9179769695, -0.4989721651, -0.2509214751, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.1245765690, -0.9785156250, -0.4998893738, 0.0000000000},
+			{-0.2430616558, -1.3247039010, -1.0709993220, -0.4999606662, -0.0000712924}
+		},
+		{
+			{0.0000000000, -1.2738990780, -1.3886718750, -0.7485466003, 0.0000000000},
+			{-0.0954781438, -1.4286281850, -1.5434009820, -0.7868337803, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.1896247860, -1.6347656250, -0.9885520935, 0.0000000000},
+			{-0.0301739699, -1.3424297030, -1.7875705420, -1.0846206160, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9885520935, -1.6347656250, -1.1896247860, 0.0000000000},
+			{0.0000000000, -1.0846206150, -1.7875705420, -1.3424297030, -0.0301739702}
+		},
+		{
+			{0.0000000000, -0.7485466003, -1.3886718750, -1.2738990780, 0.0000000000},
+			{0.0000000000, -0.7868337803, -1.5434009830, -1.4286281860, -0.0954781442}
+		},
+		{
+			{0.0000000000, -0.4998893738, -0.9785156250, -1.1245765690, 0.0000000000},
+			{-0.0000712922, -0.4999606662, -1.0709993230, -1.3247039010, -0.2001273315}
+		},
+		{
+			{0.0000000000, -0.2499961853, -0.4980468750, -0.6749153137, 0.0000000000},
+			{0.0000000000, -0.2509214751, -0.4989721651, -0.9179769694, -0.2430616557}
+		}
+	},
+	{ // 5
+		{
+			{0.0000000000, -0.6657822720, -0.5899223040, -0.3997378560, -0.1999994880, 0.0000000000},
+			{-0.1825928521, -0.8483751241, -0.5932944974, -0.4031100494, -0.1999998338, -0.0000003458}
+		},
+		{
+			{0.0000000000, -1.0295746560, -1.1193784320, -0.7959367680, -0.3999805440, 0.0000000000},
+			{-0.1825928521, -1.1530622050, -1.2091795070, -0.7976468111, -0.4016905869, 0.0000000000}
+		},
+		{
+			{0.0000000000, -1.0913771520, -1.4875914240, -1.1709020160, -0.5996666880, 0.0000000000},
+			{-0.0470712537, -1.2027098460, -1.5989241180, -1.2308838100, -0.5998699034, -0.0002032148}
+		},
+		{
+			{0.0000000000, -0.9770188800, -1.6049817600, -1.4715494400, -0.7966003200, 0.0000000000},
+			{0.0000000000, -1.0575602080, -1.7015833550, -1.5681510350, -0.8332212330, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7966003200, -1.4715494400, -1.6049817600, -0.9770188800, 0.0000000000},
+			{0.0000000000, -0.8332212330, -1.5681510350, -1.7015833550, -1.0575602080, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5996666880, -1.1709020160, -1.4875914240, -1.0913771520, 0.0000000000},
+			{-0.0002032150, -0.5998699034, -1.2308838100, -1.5989241180, -1.2027098460, -0.0470712536}
+		},
+		{
+			{0.0000000000, -0.3999805440, -0.7959367680, -1.1193784320, -1.0295746560, 0.0000000000},
+			{0.0000000000, -0.4016905869, -0.7976468111, -1.2091795060, -1.1530622050, -0.1234875493}
+		},
+		{
+			{0.0000000000, -0.1999994880, -0.3997378560, -0.5899223040, -0.6657822720, 0.0000000000},
+			{-0.0000003462, -0.1999998337, -0.4031100494, -0.5932944974, -0.8483751240, -0.1825928520}
+		}
+	},
+	{ // 6
+		{
+			{0.0000000000, -0.6395266339, -0.6406543718, -0.4980468750, -0.3332825281,
+			 -0.1666665674, 0.0000000000},
+			{-0.1414505050, -0.7809771389, -0.6469769634, -0.5043694663, -0.3333065969,
+			 -0.1666906365, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.9302012087, -1.1642534170, -0.9785156250, -0.6656505614,
+			 -0.3333286696, 0.0000000000},
+			{-0.1414505050, -1.0111284100, -1.2418269350, -0.9844022438, -0.6715371796,
+			 -0.3333316852, -0.0000030155}
+		},
+		{
+			{0.0000000000, -0.9417941363, -1.4537418080, -1.3886718750, -0.9907026368,
+			 -0.4999014656, 0.0000000000},
+			{-0.0256364817, -1.0179528520, -1.5299005240, -1.4499626650, -0.9941066270,
+			 -0.5033054560, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.8231489618, -1.4701011020, -1.6347656250, -1.2816135750,
+			 -0.6654323568, 0.0000000000},
+			{0.0000000000, -0.8664972468, -1.5421829770, -1.7068475000, -1.3337921440,
+			 -0.6661336222, -0.0007012647}
+		},
+		{
+			{0.0000000000, -0.6654323568, -1.2816135750, -1.6347656250, -1.4701011020,
+			 -0.8231489618, 0.0000000000},
+			{-0.0007012651, -0.6661336221, -1.3337921440, -1.7068475000, -1.5421829770,
+			 -0.8664972468, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4999014656, -0.9907026368, -1.3886718750, -1.4537418080,
+			 -0.9417941363, 0.0000000000},
+			{0.0000000000, -0.5033054555, -0.9941066272, -1.4499626650, -1.5299005240,
+			 -1.0179528520, -0.0256364819}
+		},
+		{
+			{0.0000000000, -0.3333286696, -0.6656505614, -0.9785156250, -1.1642534170,
+			 -0.9302012087, 0.0000000000},
+			{-0.0000030159, -0.3333316851, -0.6715371801, -0.9844022436, -1.2418269330,
+			 -1.0111284110, -0.0809272018}
+		},
+		{
+			{0.0000000000, -0.1666665674, -0.3332825281, -0.4980468750, -0.6406543718,
+			 -0.6395266339, 0.0000000000},
+			{0.0000000000, -0.1666906361, -0.3333065971, -0.5043694663, -0.6469769634,
+			 -0.7809771389, -0.1414505050}
+		}
+	},
+	{ // 7
+		{
+			{0.0000000000, -0.6074081556, -0.6658854560, -0.5649323987, -0.4280836655,
+			 -0.2857015979, -0.1428571181, 0.0000000000},
+			{-0.1124889360, -0.7198970916, -0.6747229971, -0.5737699401, -0.4282468805,
+			 -0.2858648129, -0.1428571348, -0.0000000168}
+		},
+		{
+			{0.0000000000, -0.8402142589, -1.1575299820, -1.0860156320, -0.8503141739,
+			 -0.5711177194, -0.2857128980, 0.0000000000},
+			{-0.0556896788, -0.9044693713, -1.2217850940, -1.0965065090, -0.8608050500,
+			 -0.5712503748, -0.2858455534, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.8232856607, -1.3703890210, -1.4755513680, -1.2413278450,
+			 -0.8536790776, -0.4285365618, 0.0000000000},
+			{0.0000000000, -0.8754378617, -1.4239111610, -1.5290735080, -1.2530590670,
+			 -0.8610556310, -0.4285579313, -0.0000213690}
+		},
+		{
+			{0.0000000000, -0.7092380119, -1.3230482720, -1.6348789840, -1.5352224650,
+			 -1.1195876490, -0.5709106004, 0.0000000000},
+			{0.0000000000, -0.7146779181, -1.3724979490, -1.6846212990, -1.5849647800,
+			 -1.1299831280, -0.5744665004, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5709106004, -1.1195876490, -1.5352224650, -1.6348789840,
+			 -1.3230482720, -0.7092380119, 0.0000000000},
+			{0.0000000000, -0.5744665004, -1.1299831280, -1.5849647800, -1.6846212990,
+			 -1.3724979480, -0.7146779187, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4285365618, -0.8536790776, -1.2413278450, -1.4755513680,
+			 -1.3703890210, -0.8232856607, 0.0000000000},
+			{-0.0000213695, -0.4285579312, -0.8610556306, -1.2530590670, -1.5290735090,
+			 -1.4239111620, -0.8754378607, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2857128980, -0.5711177194, -0.8503141739, -1.0860156320,
+			 -1.1575299820, -0.8402142589, 0.0000000000},
+			{0.0000000000, -0.2858455527, -0.5712503750, -0.8608050499, -1.0965065090,
+			 -1.2217850940, -0.9044693705, -0.0556896787}
+		},
+		{
+			{0.0000000000, -0.1428571181, -0.2857015979, -0.4280836655, -0.5649323987,
+			 -0.6658854560, -0.6074081556, 0.0000000000},
+			{-0.0000000165, -0.1428571349, -0.2858648129, -0.4282468805, -0.5737699401,
+			 -0.6747229971, -0.7198970918, -0.1124889362}
+		}
+	},
+	{ // 8
+		{
+			{0.0000000000, -0.5743421987, -0.6749153137, -0.6104480848, -0.4980468750,
+			 -0.3748533502, -0.2499961853, -0.1249999925, 0.0000000000},
+			{-0.0914465591, -0.6657887578, -0.6855360807, -0.6210688513, -0.4985216048,
+			 -0.3753280800, -0.2499979926, -0.1250017996, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7621243671, -1.1245765690, -1.1423158270, -0.9785156250,
+			 -0.7475069538, -0.4998893738, -0.2499995157, 0.0000000000},
+			{-0.0398691081, -0.8146623003, -1.1771145020, -1.1749795250, -0.9825942745,
+			 -0.7515856027, -0.4999367582, -0.2500469002, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.7290150896, -1.2738990780, -1.4855907480, -1.3886718750,
+			 -1.1054955800, -0.7485466003, -0.3749858961, 0.0000000000},
+			{0.0000000000, -0.7653382016, -1.3177615750, -1.5294532450, -1.4204853770,
+			 -1.1098870010, -0.7529380211, -0.3749945535, -0.0000086574}
+		},
+		{
+			{0.0000000000, -0.6222753301, -1.1896247860, -1.5648357200, -1.6347656250,
+			 -1.4064537360, -0.9885520935, -0.4997576103, 0.0000000000},
+			{-0.0010396282, -0.6239029307, -1.2229627680, -1.6057218140, -1.6756517190,
+			 -1.4384307870, -0.9921220566, -0.5033275732, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.4997576103, -0.9885520935, -1.4064537360, -1.6347656250,
+			 -1.5648357200, -1.1896247860, -0.6222753301, 0.0000000000},
+			{0.0000000000, -0.5033275732, -0.9921220566, -1.4384307870, -1.6756517210,
+			 -1.6057218160, -1.2229627670, -0.6239029312, -0.0010396274}
+		},
+		{
+			{0.0000000000, -0.3749858961, -0.7485466003, -1.1054955800, -1.3886718750,
+			 -1.4855907480, -1.2738990780, -0.7290150896, 0.0000000000},
+			{-0.0000086572, -0.3749945536, -0.7529380210, -1.1098870010, -1.4204853780,
+			 -1.5294532440, -1.3177615740, -0.7653382016, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2499995157, -0.4998893738, -0.7475069538, -0.9785156250,
+			 -1.1423158270, -1.1245765690, -0.7621243671, 0.0000000000},
+			{0.0000000000, -0.2500468999, -0.4999367583, -0.7515856026, -0.9825942745,
+			 -1.1749795250, -1.1771145020, -0.8146622999, -0.0398691080}
+		},
+		{
+			{0.0000000000, -0.1249999925, -0.2499961853, -0.3748533502, -0.4980468750,
+			 -0.6104480848, -0.6749153137, -0.5743421987, 0.0000000000},
+			{0.0000000000, -0.1250017994, -0.2499979927, -0.3753280800, -0.4985216048,
+			 -0.6210688514, -0.6855360806, -0.6657887578, -0.0914465591}
+		}
+	},
+	{ // 9
+		{
+			{0.0000000000, -0.5424494728, -0.6736180646, -0.6406543718, -0.5505141985,
+			 -0.4437678050, -0.3332825281, -0.2222209007, -0.1111111085, 0.0000000000},
+			{-0.0757269756, -0.6181764484, -0.6853348799, -0.6523711872, -0.5514347143,
+			 -0.4446883207, -0.3332995284, -0.2222379012, -0.1111111103, -0.0000000017}
+		},
+		{
+			{0.0000000000, -0.6951546024, -1.0793968670, -1.1642534170, -1.0647306270,
+			 -0.8799234157, -0.6656505614, -0.4444001721, -0.2222220312, 0.0000000000},
+			{-0.0294828261, -0.7380846756, -1.1223269400, -1.1949499330, -1.0709708310,
+			 -0.8861636194, -0.6659396301, -0.4446892410, -0.2222221549, -0.0000001240}
+		},
+		{
+			{0.0000000000, -0.6529875605, -1.1790736550, -1.4537418080, -1.4627941890,
+			 -1.2780180550, -0.9907026368, -0.6659966350, -0.3333270069, 0.0000000000},
+			{0.0000000000, -0.6788294978, -1.2141306650, -1.4887988180, -1.4927593350,
+			 -1.2866866980, -0.9977680401, -0.6662494699, -0.3335798416, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.5539828019, -1.0746824340, -1.4701011020, -1.6440390690,
+			 -1.5651015300, -1.2816135750, -0.8828334941, -0.4443209714, 0.0000000000},
+			{-0.0008191105, -0.5548019125, -1.0973038830, -1.5017664080, -1.6757043750,
+			 -1.5953070400, -1.2932740880, -0.8889044489, -0.4443917564, -0.0000707848}
+		},
+		{
+			{0.0000000000, -0.4443209714, -0.8828334941, -1.2816135750, -1.5651015300,
+			 -1.6440390690, -1.4701011020, -1.0746824340, -0.5539828019, 0.0000000000},
+			{-0.0000707851, -0.4443917564, -0.8889044480, -1.2932740890, -1.5953070390,
+			 -1.6757043750, -1.5017664080, -1.0973038840, -0.5548019125, -0.0008191106}
+		},
+		{
+			{0.0000000000, -0.3333270069, -0.6659966350, -0.9907026368, -1.2780180550,
+			 -1.4627941890, -1.4537418080, -1.1790736550, -0.6529875605, 0.0000000000},
+			{0.0000000000, -0.3335798416, -0.6662494699, -0.9977680399, -1.2866866980,
+			 -1.4927593350, -1.4887988180, -1.2141306650, -0.6788294978, 0.0000000000}
+		},
+		{
+			{0.0000000000, -0.2222220312, -0.4444001721, -0.6656505614, -0.8799234157,
+			 -1.0647306270, -1.1642534170, -1.0793968670, -0.6951546024, 0.0000000000},
+			{-0.0000001240, -0.2222221549, -0.4446892410, -0.6659396301, -0.8861636194,
+			 -1.0709708310, -1.1949499320, -1.1223269400, -0.7380846755, -0.0294828259}
+		},
+		{
+			{0.0000000000, -0.1111111085, -0.2222209007, -0.3332825281, -0.4437678050,
+			 -0.5505141985, -0.6406543718, -0.6736180646, -0.5424494728, 0.0000000000},
+			{-0.0000000020, -0.1111111102, -0.2222379011, -0.3332995285, -0.4446883209,
+			 -0.5514347142, -0.6523711873, -0.6853348798, -0.6181764486, -0.0757269758}
+		}
+	}
+};
+
+// range/bsprange-3_<divs>.asc: [divs][upper, lower bound][break point]
+static constexpr REAL cubicBSplineSlefeBounds[maxBezierSlefeDivs + 1][2][maxBezierSlefeDivs + 1] =
+{
+	{}, // 0
+	{ // 1
+		{0.1666666667, 0.0000000000},
+		{0.1025166368, -0.0641500300}
+	},
+	{ // 2
+		{0.1666666667, 0.0208333333, 0.0000000000},
+		{0.1431572691, -0.0026760642, 0.0000000000}
+	},
+	{ // 3
+		{0.1666666667, 0.0493827161, 0.0061728395, 0.0000000000},
+		{0.1550797610, 0.0377958103, 0.0029969566, -0.0014554536}
+	},
+	{ // 4
+		{0.1666666667, 0.0703125000, 0.0208333333, 0.0026041667, 0.0000000000},
+		{0.1598268583, 0.0634726916, 0.0176706184, -0.0000939743, 0.0000000000}
+	},
+	{ // 5
+		{0.1666666667, 0.0853333333, 0.0360000000, 0.0106666667, 0.0013333333,
+		 0.0000000000},
+		{0.1621651245, 0.0808317911, 0.0334118889, 0.0082535251, 0.0005930212,
+		 -0.0002648635}
+	},
+	{ // 6
+		{0.1666666667, 0.0964506173, 0.0493827161, 0.0208333333, 0.0061728395,
+		 0.0007716049, 0.0000000000},
+		{0.1634830660, 0.0932670166, 0.0473167969, 0.0188475422, 0.0052056357,
+		 0.0000026935, -0.0000000634}
+	},
+	{ // 7
+		{0.1666666667, 0.1049562682, 0.0607385812, 0.0310981536, 0.0131195335,
+		 0.0038872692, 0.0004859086, 0.0000000000},
+		{0.1642974728, 0.1025870743, 0.0590775177, 0.0294788495, 0.0121593459,
+		 0.0030252247, 0.0002051250, -0.0000873285}
+	},
+	{ // 8
+		{0.1666666667, 0.1116536458, 0.0703125000, 0.0406901042, 0.0208333333,
+		 0.0087890625, 0.0026041667, 0.0003255208, 0.0000000000},
+		{0.1648353859, 0.1098223650, 0.0689576405, 0.0393591089, 0.0199516152,
+		 0.0079616893, 0.0021883101, 0.0000088472, -0.0000006216}
+	},
+	{ // 9
+		{0.1666666667, 0.1170553269, 0.0784179241, 0.0493827161, 0.0285779607,
+		 0.0146319159, 0.0061728395, 0.0018289895, 0.0002286237, 0.0000000000},
+		{0.1652090506, 0.1155977108, 0.0772959750, 0.0482753813, 0.0277900160,
+		 0.0138765528, 0.0057157594, 0.0014287307, 0.0000930528, -0.0000383389}
+	}
+};
+
+// Bound tables by degree
+template<int Degree>
+struct BezierSlefeBounds;
+
+template<>
+struct BezierSlefeBounds<2>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return quadraticSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<3>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return cubicSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<4>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return quarticSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<5>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return quinticSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<6>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return sexticSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<7>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return septicSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<8>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return octicSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+template<>
+struct BezierSlefeBounds<9>
+{
+	static constexpr REAL
+	Get(int divs, int difference, int bound, int point)
+	{
+		return nonicSlefeBounds[divs][difference][bound][point];
+	}
+};
+
+// The same for a degree known only at run time, such as a model's
+inline REAL
+GetBezierSlefeBound(int degree, int divs, int difference, int bound, int point)
+{
+	switch (degree)
+	{
+		case 2: return BezierSlefeBounds<2>::Get(divs, difference, bound, point);
+		case 3: return BezierSlefeBounds<3>::Get(divs, difference, bound, point);
+		case 4: return BezierSlefeBounds<4>::Get(divs, difference, bound, point);
+		case 5: return BezierSlefeBounds<5>::Get(divs, difference, bound, point);
+		case 6: return BezierSlefeBounds<6>::Get(divs, difference, bound, point);
+		case 7: return BezierSlefeBounds<7>::Get(divs, difference, bound, point);
+		case 8: return BezierSlefeBounds<8>::Get(divs, difference, bound, point);
+		default: return BezierSlefeBounds<9>::Get(divs, difference, bound, point);
+	}
+}
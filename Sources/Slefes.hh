@@ -0,0 +1,337 @@
+#pragma once
+
+#include "PatchModel.hh"
+#include "SlefeKernels.hh"
+#include <cmath>
+#include <type_traits>
+#include <glm/glm.hpp>
+
+// Slefes of the patches and the boxes around them, which the tess levels are computed from by projecting the boxes to
+// the screen. Axis boxes are in model space, and tangent boxes in a frame of each patch's own.
+
+static const unsigned maxSlefeDivs = 9;
+static_assert(maxSlefeDivs <= maxBezierSlefeDivs, "No slefe kernels for the larger div counts");
+
+struct Slefe
+{
+    enum {LOWER, UPPER, NUM_BOUNDS};
+    struct Bounds
+    {
+        glm::vec3 points[maxSlefeDivs + 1][maxSlefeDivs + 1];
+    } bounds[NUM_BOUNDS];
+	glm::vec3 midPoints[maxSlefeDivs][maxSlefeDivs][2][NUM_BOUNDS];
+};
+
+struct AABB
+{
+	glm::vec3 min, max;
+};
+
+// Oriented box; axes are orthonormal
+struct OBB
+{
+	glm::vec3 center;
+	glm::vec3 axes[3];
+	glm::vec3 halfExtents;
+};
+
+struct SlefeBox
+{
+	struct AABB worldAxisBox;
+	struct OBB tangentBox; // In the patch's tangent frame, so its shape doesn't depend on the model's orientation
+	struct AABB screenAxisBox;
+	float maxScreenEdge;
+};
+
+enum {ENCLOSURE_AXIS_BOX, ENCLOSURE_TANGENT_BOX, NUM_ENCLOSURES};
+
+// A patch's boxes at the slefe break points and around its tiles, with their corners in each enclosure, which is all
+// that their screen rects are computed from
+struct PatchSlefeBoxes
+{
+	SlefeBox pointBoxes[maxSlefeDivs + 1][maxSlefeDivs + 1];
+	SlefeBox tileBoxes[maxSlefeDivs][maxSlefeDivs];
+	glm::vec3 pointVertices[NUM_ENCLOSURES][maxSlefeDivs + 1][maxSlefeDivs + 1][8];
+	glm::vec3 tileVertices[NUM_ENCLOSURES][maxSlefeDivs][maxSlefeDivs][8];
+};
+
+inline void
+ComputeSlefeMidPoints(Slefe &slefe, unsigned divs)
+{
+	for (unsigned whichBounds = 0; whichBounds < Slefe::NUM_BOUNDS; ++whichBounds)
+	{
+		auto &points = slefe.bounds[whichBounds].points;
+		for (unsigned u = 0; u < divs; ++u)
+			for (unsigned v = 0; v < divs; ++v)
+			{
+				slefe.midPoints[u][v][whichBounds][0] = glm::mix(points[u][v], points[u + 1][v + 1], 0.5);
+				slefe.midPoints[u][v][whichBounds][1] = glm::mix(points[u + 1][v], points[u][v + 1], 0.5);
+			}
+	}
+}
+
+// Slefe of a patch of the model with the given control points at divs pieces per side, computed in Real, and widened
+// by error in each axis; returns the largest distance between its lower and upper points. With a frame, of
+// orthonormal axes, the slefe is of the patch's coordinates along those axes.
+template<typename Real>
+inline float
+ComputeSlefe(const PatchModel &model, const glm::vec3 controlPoints[], const glm::vec3 &error, unsigned divs,
+		Slefe &slefe, const glm::vec3 *frame = nullptr)
+{
+	Real coeff[maxPatchVertices][threeD];
+	for (unsigned i = 0; i < model.GetNumPatchVertices(); ++i)
+		for (unsigned dim = 0; dim < threeD; ++dim)
+			coeff[i][dim] = (frame) ? glm::dot(controlPoints[i], frame[dim]) : controlPoints[i][dim];
+
+	Real lower[maxSlefeDivs + 1][maxSlefeDivs + 1][threeD];
+	Real upper[maxSlefeDivs + 1][maxSlefeDivs + 1][threeD];
+
+	// Same as tpSlefe(), outputs included, which BenchmarkSlefeKernels() checks; float has to make up for its
+	// rounding. B-spline spans get the same tensor product of bspSlefe().
+	int degreeU = model.degree[0], degreeV = model.degree[1];
+	int strideU = (degreeV + 1) * threeD, strideV = threeD;
+	int slefeStrideU = (maxSlefeDivs + 1) * threeD, slefeStrideV = threeD;
+	for (unsigned dim = 0; dim < threeD; ++dim)
+	{
+		if (model.bSpline && std::is_same<Real, float>::value)
+			BSplineTensorSlefeInflated(divs, coeff[0] + dim, strideU, strideV,
+			                           lower[0][0] + dim, upper[0][0] + dim, slefeStrideU, slefeStrideV);
+		else if (model.bSpline)
+			BSplineTensorSlefeDispatch<>::Run(divs, coeff[0] + dim, strideU, strideV,
+			                                  lower[0][0] + dim, upper[0][0] + dim, slefeStrideU, slefeStrideV);
+		else if (std::is_same<Real, float>::value)
+			BezierTensorSlefeInflated(degreeU, degreeV, divs, coeff[0] + dim, strideU, strideV,
+			                          lower[0][0] + dim, upper[0][0] + dim, slefeStrideU, slefeStrideV);
+		else
+			BezierTensorSlefeDegreeDispatch<>::Run(degreeU, degreeV, divs, coeff[0] + dim, strideU, strideV,
+			                                       lower[0][0] + dim, upper[0][0] + dim,
+			                                       slefeStrideU, slefeStrideV);
+	}
+
+	// Control points up to error off, as quantized ones are, move the patch by up to that much, since the basis sums
+	// to 1. The slefe is widened by it, so it encloses the original patch as well. Like in Slefe.comp, lower holds the
+	// upper outputs.
+	glm::vec3 bound = error;
+	if (frame)
+		bound = glm::vec3(glm::dot(glm::abs(frame[0]), error), glm::dot(glm::abs(frame[1]), error),
+		                  glm::dot(glm::abs(frame[2]), error));
+
+	float width = 0;
+	for (unsigned u = 0; u <= divs; ++u)
+		for (unsigned v = 0; v <= divs; ++v)
+		{
+			slefe.bounds[Slefe::LOWER].points[u][v] = glm::vec3(lower[u][v][0], lower[u][v][1], lower[u][v][2]) + bound;
+			slefe.bounds[Slefe::UPPER].points[u][v] = glm::vec3(upper[u][v][0], upper[u][v][1], upper[u][v][2]) - bound;
+
+			width = glm::max(width, glm::distance(slefe.bounds[Slefe::LOWER].points[u][v],
+			                                      slefe.bounds[Slefe::UPPER].points[u][v]));
+		}
+
+	ComputeSlefeMidPoints(slefe, divs);
+
+	return width;
+}
+
+inline float
+ComputeSlefe(const PatchModel &model, const glm::vec3 controlPoints[], const glm::vec3 &error, unsigned divs,
+		bool singlePrecision, Slefe &slefe, const glm::vec3 *frame = nullptr)
+{
+	return (singlePrecision) ? ComputeSlefe<float>(model, controlPoints, error, divs, slefe, frame) :
+	                           ComputeSlefe<REAL>(model, controlPoints, error, divs, slefe, frame);
+}
+
+inline AABB
+GetPointAxisBox(const Slefe &slefe, unsigned u, unsigned v)
+{
+	const glm::vec3 &lower = slefe.bounds[Slefe::LOWER].points[u][v];
+	const glm::vec3 &upper = slefe.bounds[Slefe::UPPER].points[u][v];
+
+	return {glm::min(lower, upper), glm::max(lower, upper)};
+}
+
+// Bounds of the midpoints of both diagonals of the tile, from both slefe bounds
+inline AABB
+GetTileAxisBox(const Slefe &slefe, unsigned u, unsigned v)
+{
+	AABB box = {glm::vec3(INFINITY), glm::vec3(-INFINITY)};
+
+	for (unsigned mid = 0; mid < 2; ++mid)
+	{
+		auto &midPoints = slefe.midPoints[u][v][mid];
+
+		for (unsigned whichBounds = 0; whichBounds < Slefe::NUM_BOUNDS; ++whichBounds)
+		{
+			box.max = glm::max(box.max, midPoints[whichBounds]);
+			box.min = glm::min(box.min, midPoints[whichBounds]);
+		}
+	}
+
+	return box;
+}
+
+inline void
+GetAABBVertices(const AABB &box, glm::vec3 vertices[8])
+{
+#if 0
+	for (unsigned i = 0; i < 8; ++i)
+		vertices[i] = glm::vec3((i & 1) ? box.min.x : box.max.x,
+		                        (i & 2) ? box.min.y : box.max.y,
+		                        (i & 4) ? box.min.z : box.max.z);
+#else
+	vertices[0] = box.min;
+	vertices[1] = glm::vec3(box.min.x, box.min.y, box.max.z);
+	vertices[2] = glm::vec3(box.min.x, box.max.y, box.max.z);
+	vertices[3] = glm::vec3(box.min.x, box.max.y, box.min.z);
+	vertices[4] = glm::vec3(box.max.x, box.min.y, box.min.z);
+	vertices[5] = glm::vec3(box.max.x, box.min.y, box.max.z);
+	vertices[6] = box.max;
+	vertices[7] = glm::vec3(box.max.x, box.max.y, box.min.z);
+#endif // 0
+}
+
+// Same vertex order as GetAABBVertices()
+inline void
+GetOBBVertices(const OBB &box, glm::vec3 vertices[8])
+{
+	static const float signs[8][3] =
+	{
+		{-1, -1, -1}, {-1, -1, 1}, {-1, 1, 1}, {-1, 1, -1},
+		{1, -1, -1}, {1, -1, 1}, {1, 1, 1}, {1, 1, -1}
+	};
+
+	for (unsigned i = 0; i < 8; ++i)
+	{
+		vertices[i] = box.center;
+		for (unsigned axis = 0; axis < threeD; ++axis)
+			vertices[i]+= box.axes[axis] * (signs[i][axis] * box.halfExtents[axis]);
+	}
+}
+
+// Orthonormal frame with axes[0] along du and axes[2] along the normal; false if du and dv are degenerate
+inline bool
+GetTangentFrame(const glm::vec3 &du, const glm::vec3 &dv, glm::vec3 axes[3])
+{
+	glm::vec3 normal = glm::cross(du, dv);
+	if (glm::dot(normal, normal) < 1e-12f)
+		return false;
+
+	axes[0] = glm::normalize(du);
+	axes[2] = glm::normalize(normal);
+	axes[1] = glm::cross(axes[2], axes[0]);
+	return true;
+}
+
+// The frame of a patch's tangent boxes, from the corners of the mid-surface between its slefe bounds, which stands in
+// for the patch itself
+inline void
+GetSlefeTangentFrame(const Slefe &slefe, unsigned divs, glm::vec3 axes[3])
+{
+	glm::vec3 mid[2][2];
+	for (unsigned u = 0; u < 2; ++u)
+		for (unsigned v = 0; v < 2; ++v)
+			mid[u][v] = (slefe.bounds[Slefe::LOWER].points[u * divs][v * divs] +
+			             slefe.bounds[Slefe::UPPER].points[u * divs][v * divs]) * 0.5f;
+
+	// Along the diagonals for degenerate corners, e.g. the poles of the teapot's lid, or else the world axes
+	axes[0] = glm::vec3(1, 0, 0);
+	axes[1] = glm::vec3(0, 1, 0);
+	axes[2] = glm::vec3(0, 0, 1);
+	if (!GetTangentFrame(mid[1][0] - mid[0][0] + mid[1][1] - mid[0][1],
+	                     mid[0][1] - mid[0][0] + mid[1][1] - mid[1][0], axes))
+		GetTangentFrame(mid[1][1] - mid[0][0], mid[0][1] - mid[1][0], axes);
+}
+
+// Box in the given frame around a box of coordinates along its axes
+inline void
+ComputeOBB(OBB &box, const glm::vec3 axes[3], const AABB &localBox)
+{
+	glm::vec3 localCenter = (localBox.min + localBox.max) * 0.5f;
+	box.center = glm::vec3(0);
+	for (unsigned axis = 0; axis < threeD; ++axis)
+	{
+		box.axes[axis] = axes[axis];
+		box.center+= axes[axis] * localCenter[axis];
+	}
+	box.halfExtents = (localBox.max - localBox.min) * 0.5f;
+}
+
+// Boxes of a patch with the given control points from its slefe, and in its tangent frame from the slefe of its
+// coordinates along the frame's axes, so that they hold the surface for the same reason the axis boxes do. The frame
+// is the patch's, since each one takes a slefe.
+inline void
+ComputePatchSlefeBoxes(const PatchModel &model, const glm::vec3 controlPoints[], const glm::vec3 &error,
+		unsigned divs, bool singlePrecision, const Slefe &slefe, PatchSlefeBoxes &boxes)
+{
+	glm::vec3 axes[3];
+	GetSlefeTangentFrame(slefe, divs, axes);
+
+	Slefe frameSlefe;
+	ComputeSlefe(model, controlPoints, error, divs, singlePrecision, frameSlefe, axes);
+
+	for (unsigned u = 0; u <= divs; ++u)
+		for (unsigned v = 0; v <= divs; ++v)
+		{
+			SlefeBox &pointBox = boxes.pointBoxes[u][v];
+			pointBox.worldAxisBox = GetPointAxisBox(slefe, u, v);
+			GetAABBVertices(pointBox.worldAxisBox, boxes.pointVertices[ENCLOSURE_AXIS_BOX][u][v]);
+			ComputeOBB(pointBox.tangentBox, axes, GetPointAxisBox(frameSlefe, u, v));
+			GetOBBVertices(pointBox.tangentBox, boxes.pointVertices[ENCLOSURE_TANGENT_BOX][u][v]);
+
+			if (u < divs && v < divs)
+			{
+				SlefeBox &tileBox = boxes.tileBoxes[u][v];
+				tileBox.worldAxisBox = GetTileAxisBox(slefe, u, v);
+				GetAABBVertices(tileBox.worldAxisBox, boxes.tileVertices[ENCLOSURE_AXIS_BOX][u][v]);
+				ComputeOBB(tileBox.tangentBox, axes, GetTileAxisBox(frameSlefe, u, v));
+				GetOBBVertices(tileBox.tangentBox, boxes.tileVertices[ENCLOSURE_TANGENT_BOX][u][v]);
+			}
+		}
+}
+
+inline void
+ComputeSlefeRect(SlefeBox &box,
+		const glm::vec3 *worldVertices, unsigned numVertices,
+		const glm::mat4 &modelViewProjection, const glm::vec3 &halfWindowSize)
+{
+	glm::vec3 &screenMin = box.screenAxisBox.min;
+	glm::vec3 &screenMax = box.screenAxisBox.max;
+
+	screenMin = glm::vec3(INFINITY);
+	screenMax = glm::vec3(-INFINITY);
+
+	for (unsigned i = 0; i < numVertices; ++i)
+	{
+		glm::vec4 worldVertex = glm::vec4(worldVertices[i], 1);
+		glm::vec4 clipVertex = modelViewProjection * worldVertex;
+		glm::vec3 normVertex = glm::vec3(clipVertex[0], clipVertex[1], clipVertex[2]) / glm::vec3(clipVertex.w);
+		glm::vec3 winVertex = halfWindowSize + normVertex * halfWindowSize;
+
+		for (unsigned dim = 0; dim < threeD; ++dim)
+		{
+			screenMin[dim] = glm::min(screenMin[dim], winVertex[dim]);
+			screenMax[dim] = glm::max(screenMax[dim], winVertex[dim]);
+		}
+	}
+
+	box.maxScreenEdge = glm::max(screenMax.x - screenMin.x, screenMax.y - screenMin.y);
+}
+
+// Screen rects of a patch's boxes in an enclosure, which can go into boxes other than the patch's own. Every
+// enclosure is a box holding all of the box the slefe bounds span per coordinate, since the surface can be anywhere
+// in it.
+inline void
+ProjectSlefeBoxes(const PatchSlefeBoxes &boxes, int enclosure, unsigned divs,
+		const glm::mat4 &modelViewProjection, const glm::vec3 &halfWindowSize,
+		SlefeBox (&pointBoxes)[maxSlefeDivs + 1][maxSlefeDivs + 1], SlefeBox (&tileBoxes)[maxSlefeDivs][maxSlefeDivs])
+{
+	for (unsigned u = 0; u <= divs; ++u)
+		for (unsigned v = 0; v <= divs; ++v)
+		{
+			ComputeSlefeRect(pointBoxes[u][v], boxes.pointVertices[enclosure][u][v], 8, modelViewProjection,
+			                 halfWindowSize);
+
+			if (u < divs && v < divs)
+				ComputeSlefeRect(tileBoxes[u][v], boxes.tileVertices[enclosure][u][v], 8, modelViewProjection,
+				                 halfWindowSize);
+		}
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "Slefes.hh"
+#include <cmath>
+#include <glm/glm.hpp>
+
+// Tess levels of the patches from the screen rects of their slefe boxes, and how they're stored at the control points
+// for iPASS.tesc
+
+static const unsigned maxTessGenLevel = 64;
+
+// Everything the pipelined tess level worker needs from the render thread
+struct TessLevelJob
+{
+	glm::mat4 modelViewProjection;
+	int screenWidth, screenHeight;
+	int enclosure;
+	int patchRange[2];
+	unsigned numSlefeDivs;
+	float pixelAccuracy;
+	float mysteryFactor;
+	bool fracTessLevels;
+};
+
+struct TessLevelResult
+{
+	float vertexTessLevels[maxModelVertices];
+	int enclosure;
+	unsigned estimatedTriangles;
+};
+
+inline bool
+SameTessSettings(const TessLevelJob &a, const TessLevelJob &b)
+{
+	return (a.screenWidth == b.screenWidth && a.screenHeight == b.screenHeight && a.enclosure == b.enclosure &&
+			a.patchRange[0] == b.patchRange[0] && a.patchRange[1] == b.patchRange[1] &&
+			a.numSlefeDivs == b.numSlefeDivs && a.pixelAccuracy == b.pixelAccuracy &&
+			a.mysteryFactor == b.mysteryFactor && a.fracTessLevels == b.fracTessLevels);
+}
+
+// Level for a patch from the screen rects of its point and tile boxes. tileMaxScreenEdges, if given, gets each tile's
+// longest screen edge, or -1 for tiles outside the view.
+inline float
+ComputeSlefeTessLevel(const SlefeBox (&pointBoxes)[maxSlefeDivs + 1][maxSlefeDivs + 1],
+		const SlefeBox (&tileBoxes)[maxSlefeDivs][maxSlefeDivs], unsigned divs,
+		int screenWidth, int screenHeight, float pixelAccuracy, float mysteryFactor,
+		float (*tileMaxScreenEdges)[maxSlefeDivs] = nullptr)
+{
+	float patchMaxScreenEdge = 0;
+
+	for (unsigned u = 0; u < divs; ++u)
+		for (unsigned v = 0; v < divs; ++v)
+		{
+			AABB tileBox = {glm::vec3(INFINITY), glm::vec3(-INFINITY)};
+			float tileMaxScreenEdge = tileBoxes[u][v].maxScreenEdge;
+
+			for (unsigned uOff = 0; uOff < 2; ++uOff)
+				for (unsigned vOff = 0; vOff < 2; ++vOff)
+				{
+					tileBox.min = glm::min(pointBoxes[u + uOff][v + vOff].screenAxisBox.min, tileBox.min);
+					tileBox.max = glm::max(pointBoxes[u + uOff][v + vOff].screenAxisBox.max, tileBox.max);
+
+					tileMaxScreenEdge = glm::max(tileMaxScreenEdge, pointBoxes[u + uOff][v + vOff].maxScreenEdge);
+				}
+
+			if (tileMaxScreenEdges)
+				tileMaxScreenEdges[u][v] = -1;
+
+			if (tileBox.min.x > screenWidth || tileBox.min.y > screenHeight || tileBox.min.z > 1 ||
+					tileBox.max.x < 0 || tileBox.max.y < 0 || tileBox.max.z < 0)
+				continue;
+
+			if (tileMaxScreenEdges)
+				tileMaxScreenEdges[u][v] = tileMaxScreenEdge;
+
+			patchMaxScreenEdge = glm::max(tileMaxScreenEdge, patchMaxScreenEdge);
+		}
+
+	return divs * sqrtf(patchMaxScreenEdge / pixelAccuracy) * mysteryFactor;
+}
+
+// Stores a per-patch value at the patch's inner control points, where iPASS.tesc reads it: [1][1] of a Bezier
+// patch, which no other patch has, or all 4 of a B-spline span's, each shared with 3 other spans and keeping the
+// largest of their values. The latter expects the values to start out at 0.
+inline void
+SetPatchInnerValue(const PatchModel &model, float vertexValues[maxModelVertices], int patchIndex, float value)
+{
+	if (!model.bSpline)
+		vertexValues[model.GetIndex(patchIndex, 1, 1)] = value;
+	else
+		for (unsigned u = 1; u <= 2; ++u)
+			for (unsigned v = 1; v <= 2; ++v)
+			{
+				unsigned index = model.GetIndex(patchIndex, u, v);
+				vertexValues[index] = glm::max(vertexValues[index], value);
+			}
+}
+
+inline float
+GetPatchInnerValue(const PatchModel &model, const float vertexValues[maxModelVertices], int patchIndex)
+{
+	if (!model.bSpline)
+		return vertexValues[model.GetIndex(patchIndex, 1, 1)];
+
+	float value = 0;
+	for (unsigned u = 1; u <= 2; ++u)
+		for (unsigned v = 1; v <= 2; ++v)
+			value = glm::max(value, vertexValues[model.GetIndex(patchIndex, u, v)]);
+
+	return value;
+}
+
+// A Bezier patch stores its level at one inner control point of each edge, the first from its corner going
+// counterclockwise, so the patch across the edge, which goes around it the other way, picks the other end. Below
+// degree 3 there's only one, which both keep the larger level at. A B-spline span's edge levels come from the
+// inner control points along it, which the span across the edge has too, so both get the largest level of the 6
+// spans around the edge. Either way the levels have to start out at 0.
+inline void
+SetPatchTessLevel(const PatchModel &model, float vertexTessLevels[maxModelVertices], int patchIndex, float tessLevel)
+{
+	unsigned du = model.degree[0], dv = model.degree[1];
+
+	if (!model.bSpline)
+		for (unsigned index : {model.GetIndex(patchIndex, 0, dv - 1), model.GetIndex(patchIndex, du - 1, dv),
+		                       model.GetIndex(patchIndex, du, 1), model.GetIndex(patchIndex, 1, 0)})
+			vertexTessLevels[index] = glm::max(vertexTessLevels[index], tessLevel);
+	SetPatchInnerValue(model, vertexTessLevels, patchIndex, tessLevel);
+}
+
+// The outer and inner levels iPASS.tesc derives from the per-vertex levels
+inline void
+GetPatchTessLevels(const PatchModel &model, const float vertexTessLevels[maxModelVertices], int patchIndex,
+		float outer[4], float inner[2])
+{
+	unsigned du = model.degree[0], dv = model.degree[1];
+	auto level = [&](unsigned u, unsigned v) { return vertexTessLevels[model.GetIndex(patchIndex, u, v)]; };
+
+	if (model.bSpline)
+	{
+		outer[0] = glm::max(level(1, 1), level(2, 1));
+		outer[1] = glm::max(level(1, 1), level(1, 2));
+		outer[2] = glm::max(level(1, 2), level(2, 2));
+		outer[3] = glm::max(level(2, 1), level(2, 2));
+	}
+	else
+	{
+		outer[0] = glm::max(level(du - 1, 0), level(1, 0));
+		outer[1] = glm::max(level(0, 1), level(0, dv - 1));
+		outer[2] = glm::max(level(1, dv), level(du - 1, dv));
+		outer[3] = glm::max(level(du, dv - 1), level(du, 1));
+	}
+	inner[0] = inner[1] = GetPatchInnerValue(model, vertexTessLevels, patchIndex);
+}
+
+// Number of triangles GL generates for a quad patch with all of its levels set to level
+inline unsigned
+EstimatePatchTriangles(float level, bool fracTess)
+{
+	if (level <= 0)
+		return 0;
+
+	level = glm::min(level, float(maxTessGenLevel));
+
+	unsigned segments;
+	if (fracTess)
+		segments = glm::max(2 * unsigned(ceilf(level / 2)), 2u);
+	else
+		segments = glm::max(unsigned(ceilf(level)), 1u);
+
+	return 2 * segments * segments;
+}
+
+// Levels of the job's patches from their slefe boxes. Safe on any thread while the boxes aren't being rebuilt, since
+// the screen rects go into local boxes.
+inline void
+ComputeJobTessLevels(const PatchModel &model, const PatchSlefeBoxes patchSlefeBoxes[], const TessLevelJob &job,
+		TessLevelResult &result)
+{
+	SlefeBox pointBoxes[maxSlefeDivs + 1][maxSlefeDivs + 1];
+	SlefeBox tileBoxes[maxSlefeDivs][maxSlefeDivs];
+	glm::vec3 halfWindowSize = glm::vec3(job.screenWidth / 2.0, job.screenHeight / 2.0, 0.5);
+
+	for (unsigned i = 0; i < model.numVertices; ++i)
+		result.vertexTessLevels[i] = 0;
+
+	result.enclosure = job.enclosure;
+	result.estimatedTriangles = 0;
+
+	for (int patchIndex = job.patchRange[0]; patchIndex < job.patchRange[0] + job.patchRange[1]; ++patchIndex)
+	{
+		ProjectSlefeBoxes(patchSlefeBoxes[patchIndex], job.enclosure, job.numSlefeDivs, job.modelViewProjection,
+		                  halfWindowSize, pointBoxes, tileBoxes);
+
+		float tessLevel = ComputeSlefeTessLevel(pointBoxes, tileBoxes, job.numSlefeDivs,
+		                                        job.screenWidth, job.screenHeight,
+		                                        job.pixelAccuracy, job.mysteryFactor);
+		result.estimatedTriangles+= EstimatePatchTriangles(tessLevel, job.fracTessLevels);
+
+		SetPatchTessLevel(model, result.vertexTessLevels, patchIndex, tessLevel);
+	}
+}
@@ -0,0 +1,124 @@
+// Checks the tess levels against the pixel accuracy without a GPU: computes each patch's level from its slefe boxes
+// like TESS_IPASS_PIPELINED does, tessellates it on the CPU like GL would, and measures the screen-space error, over
+// random views of a model. Exits non-zero if a patch's error is over the pixel accuracy, unless its levels are
+// clamped to maxTessGenLevel, where no level would do.
+
+#include "PatchModel.hh"
+#include "Slefes.hh"
+#include "TessLevels.hh"
+#include "Calibration.hh"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <glm/gtc/matrix_transform.hpp>
+
+using std::clog;
+using std::cout;
+using std::endl;
+
+// The app's default window and camera
+static const int screenWidth = 1280, screenHeight = 720;
+static const float fov = 70;
+static const float minCameraZ = 0.1f;
+static const float maxCameraZ = 100.0f;
+
+static PatchSlefeBoxes patchSlefeBoxes[maxModelPatches];
+static TessError patchErrors[maxModelPatches];
+
+int
+main(int argc, char *argv[])
+{
+	if (argc > 7)
+	{
+		clog << "Usage: " << argv[0] << " [model [views [divs [enclosure [mystery factor [pixel accuracy]]]]]]"
+		     << endl;
+		return 2;
+	}
+
+	int modelIndex = (argc > 1) ? std::atoi(argv[1]) : MODEL_TEAPOT;
+	unsigned numViews = (argc > 2) ? std::atoi(argv[2]) : 100;
+	unsigned divs = (argc > 3) ? std::atoi(argv[3]) : 3;
+	int enclosure = (argc > 4) ? std::atoi(argv[4]) : ENCLOSURE_AXIS_BOX;
+	float mysteryFactor = (argc > 5) ? std::atof(argv[5]) : 1.5f;
+	float pixelAccuracy = (argc > 6) ? std::atof(argv[6]) : 0.5f;
+
+	if (modelIndex < 0 || modelIndex >= NUM_MODELS || divs < 2 || divs > maxSlefeDivs ||
+			enclosure < 0 || enclosure >= NUM_ENCLOSURES || !(mysteryFactor > 0) || !(pixelAccuracy > 0))
+	{
+		clog << "Invalid arguments" << endl;
+		return 2;
+	}
+
+	const PatchModel &model = patchModels[modelIndex];
+	for (int patchIndex = 0; patchIndex < model.numPatches; ++patchIndex)
+	{
+		glm::vec3 controlPoints[maxPatchVertices];
+		for (unsigned i = 0; i < model.GetNumPatchVertices(); ++i)
+		{
+			const float *vertex = model.vertices[model.GetPatchIndices(patchIndex)[i]];
+			controlPoints[i] = glm::vec3(vertex[0], vertex[1], vertex[2]);
+		}
+
+		Slefe slefe;
+		ComputeSlefe(model, controlPoints, glm::vec3(0), divs, false, slefe);
+		ComputePatchSlefeBoxes(model, controlPoints, glm::vec3(0), divs, false, slefe, patchSlefeBoxes[patchIndex]);
+	}
+
+	TessLevelJob job;
+	job.screenWidth = screenWidth;
+	job.screenHeight = screenHeight;
+	job.enclosure = enclosure;
+	job.patchRange[0] = 0;
+	job.patchRange[1] = model.numPatches;
+	job.numSlefeDivs = divs;
+	job.pixelAccuracy = pixelAccuracy;
+	job.mysteryFactor = mysteryFactor;
+	job.fracTessLevels = false;
+
+	glm::mat4 projectionMatrix = glm::perspective(glm::radians(fov), float(screenWidth) / float(screenHeight),
+	                                              minCameraZ, maxCameraZ);
+	glm::vec3 modelCentroid = GetModelCentroid(model);
+	std::mt19937 random(1);
+
+	TessError totalError = {};
+	unsigned numFailures = 0, numSaturated = 0;
+	static TessLevelResult result;
+
+	for (unsigned view = 0; view < numViews; ++view)
+	{
+		job.modelViewProjection = projectionMatrix * GetRandomView(random, modelCentroid);
+		ComputeJobTessLevels(model, patchSlefeBoxes, job, result);
+
+		TessError viewError = MeasureReferenceError(model, result.vertexTessLevels, 0, model.numPatches,
+		                                            TESS_EQUAL_SPACING, job.modelViewProjection,
+		                                            glm::vec2(screenWidth, screenHeight), 99, patchErrors);
+		AccumulateTessError(totalError, viewError);
+
+		for (int patchIndex = 0; patchIndex < model.numPatches; ++patchIndex)
+		{
+			if (!(patchErrors[patchIndex].maxError > pixelAccuracy))
+				continue;
+
+			float outer[4], inner[2];
+			GetPatchTessLevels(model, result.vertexTessLevels, patchIndex, outer, inner);
+			bool saturated = false;
+			for (float level : {outer[0], outer[1], outer[2], outer[3], inner[0], inner[1]})
+				saturated|= (level >= maxTessGenLevel);
+
+			if (saturated)
+				++numSaturated;
+			else
+			{
+				++numFailures;
+				clog << "View " << view << ", patch " << patchIndex << ": error " << patchErrors[patchIndex].maxError
+				     << " pixels" << endl;
+			}
+		}
+	}
+
+	cout << numViews << " views, " << totalError.numTriangles << " triangles, max error " << totalError.maxError
+	     << ", p99 error " << totalError.percentileError << ", " << numSaturated << " saturated patches over "
+	     << pixelAccuracy << endl;
+
+	return (numFailures) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
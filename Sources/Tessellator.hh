@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <glm/glm.hpp>
+
+// CPU reference for GL's quad-domain tessellation and for BicubicBezier() in BicubicBezier.glsl, so that tess levels
+// can be checked for triangle counts and screen-space error without a GPU.
+
+enum TessSpacing {TESS_EQUAL_SPACING, TESS_FRACTIONAL_EVEN_SPACING};
+
+// Parametric coordinates of a tessellated quad patch and the triangles connecting them
+struct QuadTessellation
+{
+	std::vector<glm::vec2> coords;
+	std::vector<unsigned> indices;
+
+	unsigned
+	GetNumTriangles() const
+	{
+		return indices.size() / 3;
+	}
+};
+
+// Number of segments GL splits an edge with the given level into; 0 if the level discards the patch
+static unsigned
+GetTessSegments(float level, TessSpacing spacing, unsigned maxLevel)
+{
+	if (!(level > 0))
+		return 0;
+
+	if (spacing == TESS_EQUAL_SPACING)
+		return unsigned(ceilf(glm::clamp(level, 1.0f, float(maxLevel))));
+	else
+		return 2 * unsigned(ceilf(glm::clamp(level, 2.0f, float(maxLevel)) / 2));
+}
+
+// Parametric positions of the segment ends along an edge, from 0 to 1. With fractional even spacing the two short
+// segments go in the middle of the edge; the spec leaves their placement to the implementation.
+static void
+GetTessEdgePositions(float level, TessSpacing spacing, unsigned maxLevel, std::vector<float> &positions)
+{
+	unsigned numSegments = GetTessSegments(level, spacing, maxLevel);
+	positions.resize(numSegments + 1);
+
+	if (spacing == TESS_EQUAL_SPACING)
+	{
+		for (unsigned i = 0; i <= numSegments; ++i)
+			positions[i] = float(i) / numSegments;
+	}
+	else
+	{
+		float segmentLength = 1 / glm::clamp(level, 2.0f, float(maxLevel));
+
+		for (unsigned i = 0; i < numSegments / 2; ++i)
+		{
+			positions[i] = i * segmentLength;
+			positions[numSegments - i] = 1 - positions[i];
+		}
+		positions[numSegments / 2] = 0.5;
+	}
+}
+
+// Triangulates the strip between an outer edge and the facing edge of the inner region, both ordered along the edge.
+// Any triangulation of the strip has one triangle per segment on either side, which is all GL guarantees.
+static void
+StitchTessEdges(QuadTessellation &tess, const std::vector<glm::vec2> &outer, const std::vector<glm::vec2> &inner, int axis)
+{
+	unsigned outerStart = tess.coords.size();
+	tess.coords.insert(tess.coords.end(), outer.begin(), outer.end());
+	unsigned innerStart = tess.coords.size();
+	tess.coords.insert(tess.coords.end(), inner.begin(), inner.end());
+
+	unsigned i = 0, j = 0;
+	while (i + 1 < outer.size() || j + 1 < inner.size())
+	{
+		bool advanceOuter = (j + 1 == inner.size() ||
+				(i + 1 < outer.size() && outer[i][axis] + outer[i + 1][axis] < inner[j][axis] + inner[j + 1][axis]));
+
+		tess.indices.push_back(outerStart + i);
+		tess.indices.push_back(innerStart + j);
+		if (advanceOuter)
+			tess.indices.push_back(outerStart + ++i);
+		else
+			tess.indices.push_back(innerStart + ++j);
+	}
+}
+
+// Same domain subdivision as layout (quads) with the given spacing: outer[0..3] are the u = 0, v = 0, u = 1 and v = 1
+// edges, inner[0] and inner[1] subdivide along u and v.
+static void
+TessellateQuad(const float outer[4], const float inner[2], TessSpacing spacing, unsigned maxLevel,
+		QuadTessellation &tess)
+{
+	tess.coords.clear();
+	tess.indices.clear();
+
+	std::vector<float> outerPositions[4];
+	for (unsigned edge = 0; edge < 4; ++edge)
+	{
+		if (!GetTessSegments(outer[edge], spacing, maxLevel))
+			return;
+
+		GetTessEdgePositions(outer[edge], spacing, maxLevel, outerPositions[edge]);
+	}
+
+	float innerLevels[2];
+	bool singleQuad = true;
+	for (unsigned axis = 0; axis < 2; ++axis)
+	{
+		innerLevels[axis] = (inner[axis] > 1) ? inner[axis] : 1;
+		singleQuad&= (GetTessSegments(innerLevels[axis], spacing, maxLevel) == 1);
+	}
+	for (unsigned edge = 0; edge < 4; ++edge)
+		singleQuad&= (outerPositions[edge].size() == 2);
+
+	if (singleQuad)
+	{
+		tess.coords = {glm::vec2(0, 0), glm::vec2(1, 0), glm::vec2(1, 1), glm::vec2(0, 1)};
+		tess.indices = {0, 1, 2, 0, 2, 3};
+		return;
+	}
+
+	// An inner level of one is treated as slightly more than one, which rounds up to two segments
+	std::vector<float> innerPositions[2];
+	for (unsigned axis = 0; axis < 2; ++axis)
+	{
+		if (GetTessSegments(innerLevels[axis], spacing, maxLevel) == 1)
+			innerLevels[axis] = 2;
+
+		GetTessEdgePositions(innerLevels[axis], spacing, maxLevel, innerPositions[axis]);
+	}
+
+	const std::vector<float> &us = innerPositions[0], &vs = innerPositions[1];
+	unsigned numUs = us.size() - 1, numVs = vs.size() - 1;
+
+	// Inner region, which is just a line or a point when an inner level has two segments
+	unsigned gridStart = tess.coords.size();
+	for (unsigned j = 1; j < numVs; ++j)
+		for (unsigned i = 1; i < numUs; ++i)
+			tess.coords.push_back(glm::vec2(us[i], vs[j]));
+
+	unsigned gridWidth = numUs - 1;
+	for (unsigned j = 0; j + 1 < numVs - 1; ++j)
+		for (unsigned i = 0; i + 1 < numUs - 1; ++i)
+		{
+			unsigned corner = gridStart + j * gridWidth + i;
+			unsigned quad[4] = {corner, corner + 1, corner + gridWidth + 1, corner + gridWidth};
+			tess.indices.insert(tess.indices.end(), {quad[0], quad[1], quad[2], quad[0], quad[2], quad[3]});
+		}
+
+	// Outer ring
+	std::vector<glm::vec2> outerEdge, innerEdge;
+	for (unsigned edge = 0; edge < 4; ++edge)
+	{
+		bool alongU = (edge & 1);
+		float fixed = (edge < 2) ? 0 : 1;
+		float innerFixed = (alongU) ? ((edge < 2) ? vs[1] : vs[numVs - 1]) : ((edge < 2) ? us[1] : us[numUs - 1]);
+
+		outerEdge.clear();
+		for (float t : outerPositions[edge])
+			outerEdge.push_back((alongU) ? glm::vec2(t, fixed) : glm::vec2(fixed, t));
+
+		innerEdge.clear();
+		const std::vector<float> &innerTs = (alongU) ? us : vs;
+		for (unsigned i = 1; i < innerTs.size() - 1; ++i)
+			innerEdge.push_back((alongU) ? glm::vec2(innerTs[i], innerFixed) : glm::vec2(innerFixed, innerTs[i]));
+
+		StitchTessEdges(tess, outerEdge, innerEdge, (alongU) ? 0 : 1);
+	}
+}
+
+static const unsigned maxBezierDegree = 15;
+
+// Bernstein polynomials of a degree at t, built up a degree at a time like de Casteljau's algorithm
+static void
+BernsteinBasis(unsigned degree, float t, float basis[maxBezierDegree + 1])
+{
+	float s = 1 - t;
+
+	basis[0] = 1;
+	for (unsigned k = 1; k <= degree; ++k)
+	{
+		basis[k] = t * basis[k - 1];
+		for (unsigned j = k - 1; j > 0; --j)
+			basis[j] = s * basis[j] + t * basis[j - 1];
+		basis[0]*= s;
+	}
+}
+
+// Same surface as BicubicBezier() in BicubicBezier.glsl, with the (degreeY + 1) rows of constant v of (degreeX + 1)
+// control points each
+static glm::vec3
+EvaluateBezierPatch(const glm::vec3 controlPoints[], unsigned degreeX, unsigned degreeY, const glm::vec2 &uv)
+{
+	float basis[2][maxBezierDegree + 1];
+	BernsteinBasis(degreeX, uv.x, basis[0]);
+	BernsteinBasis(degreeY, uv.y, basis[1]);
+
+	glm::vec3 position(0);
+	for (unsigned v = 0; v <= degreeY; ++v)
+		for (unsigned u = 0; u <= degreeX; ++u)
+			position+= controlPoints[v * (degreeX + 1) + u] * (basis[0][u] * basis[1][v]);
+
+	return position;
+}
+
+// Bezier control points of a uniform bicubic B-spline span, as iPASS.tesc converts them: in each direction the Bezier
+// points are (s0 + 4 s1 + s2) / 6, (4 s1 + 2 s2) / 6, (2 s1 + 4 s2) / 6 and (s1 + 4 s2 + s3) / 6
+static void
+BSplineToBezier(const glm::vec3 in[16], glm::vec3 out[16])
+{
+	static const float weights[4][4] = {{1, 4, 1, 0}, {0, 4, 2, 0}, {0, 2, 4, 0}, {0, 1, 4, 1}};
+
+	glm::vec3 rows[16];
+	for (unsigned v = 0; v < 4; ++v)
+		for (unsigned u = 0; u < 4; ++u)
+		{
+			rows[v * 4 + u] = glm::vec3(0);
+			for (unsigned k = 0; k < 4; ++k)
+				rows[v * 4 + u]+= in[v * 4 + k] * (weights[u][k] / 6);
+		}
+
+	for (unsigned v = 0; v < 4; ++v)
+		for (unsigned u = 0; u < 4; ++u)
+		{
+			out[v * 4 + u] = glm::vec3(0);
+			for (unsigned k = 0; k < 4; ++k)
+				out[v * 4 + u]+= rows[k * 4 + u] * (weights[v][k] / 6);
+		}
+}
+
+struct TessError
+{
+	unsigned numTriangles;
+	unsigned numSamples;
+	float maxError;
+	float percentileError;
+};
+
+// Screen-space distance in pixels between the tessellated patch and the limit surface, with the same comparison as
+// Debug.frag's SHOW_ERROR path: a point on a triangle against the surface at that point's interpolated parametric
+// coordinates. Each triangle is sampled on a barycentric grid and samples outside the view volume are skipped.
+static TessError
+MeasureTessError(const glm::vec3 controlPoints[], unsigned degreeX, unsigned degreeY, const QuadTessellation &tess,
+		const glm::mat4 &modelViewProjection, const glm::vec2 &viewportSize, float percentile,
+		unsigned samplesPerEdge = 4)
+{
+	TessError error = {tess.GetNumTriangles(), 0, 0, 0};
+
+	std::vector<glm::vec3> positions(tess.coords.size());
+	for (unsigned i = 0; i < tess.coords.size(); ++i)
+		positions[i] = EvaluateBezierPatch(controlPoints, degreeX, degreeY, tess.coords[i]);
+
+	glm::vec2 halfViewport = viewportSize * 0.5f;
+	std::vector<float> errors;
+
+	for (unsigned triangle = 0; triangle < error.numTriangles; ++triangle)
+	{
+		const unsigned *corners = &tess.indices[triangle * 3];
+
+		for (unsigned a = 0; a <= samplesPerEdge; ++a)
+			for (unsigned b = 0; a + b <= samplesPerEdge; ++b)
+			{
+				glm::vec3 weights = glm::vec3(a, b, samplesPerEdge - a - b) / float(samplesPerEdge);
+
+				glm::vec3 approxPos(0);
+				glm::vec2 uv(0);
+				for (unsigned i = 0; i < 3; ++i)
+				{
+					approxPos+= positions[corners[i]] * weights[i];
+					uv+= tess.coords[corners[i]] * weights[i];
+				}
+
+				glm::vec4 approxClip = modelViewProjection * glm::vec4(approxPos, 1);
+				if (approxClip.w <= 0 || fabsf(approxClip.x) > approxClip.w || fabsf(approxClip.y) > approxClip.w ||
+						fabsf(approxClip.z) > approxClip.w)
+					continue;
+
+				glm::vec3 limitPos = EvaluateBezierPatch(controlPoints, degreeX, degreeY, uv);
+				glm::vec4 limitClip = modelViewProjection * glm::vec4(limitPos, 1);
+				if (limitClip.w <= 0)
+					continue;
+
+				glm::vec2 approxScreen = glm::vec2(approxClip.x, approxClip.y) / approxClip.w * halfViewport;
+				glm::vec2 limitScreen = glm::vec2(limitClip.x, limitClip.y) / limitClip.w * halfViewport;
+				errors.push_back(glm::distance(approxScreen, limitScreen));
+			}
+	}
+
+	error.numSamples = errors.size();
+	if (errors.empty())
+		return error;
+
+	error.maxError = *std::max_element(errors.begin(), errors.end());
+
+	auto nth = errors.begin() + std::min(size_t(errors.size() * percentile / 100), errors.size() - 1);
+	std::nth_element(errors.begin(), nth, errors.end());
+	error.percentileError = *nth;
+
+	return error;
+}
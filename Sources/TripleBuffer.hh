@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+
+// Hands the latest value from one producer thread to one consumer thread without either of them ever waiting: the
+// producer fills GetWriteBuffer() and calls Publish(), and the consumer calls Acquire() to swap the most recently
+// published value, if there's a new one, into GetReadBuffer(). Values published in between are skipped.
+template<typename T>
+class TripleBuffer
+{
+	static const unsigned freshBit = 4;
+
+	T buffers[3];
+	std::atomic<unsigned> middle; // Index of the buffer between the two threads, with freshBit if not acquired yet
+	unsigned write, read;
+
+public:
+	TripleBuffer()
+	{
+		Reset();
+	}
+
+	// Only while neither thread is using the buffer
+	void
+	Reset()
+	{
+		write = 0;
+		middle = 1;
+		read = 2;
+	}
+
+	T &
+	GetWriteBuffer()
+	{
+		return buffers[write];
+	}
+
+	void
+	Publish()
+	{
+		write = middle.exchange(write | freshBit, std::memory_order_acq_rel) & ~freshBit;
+	}
+
+	// Only the consumer clears freshBit, so a value published between the load and the exchange is just as new
+	bool
+	Acquire()
+	{
+		if (!(middle.load(std::memory_order_acquire) & freshBit))
+			return false;
+
+		read = middle.exchange(read, std::memory_order_acq_rel) & ~freshBit;
+		return true;
+	}
+
+	const T &
+	GetReadBuffer() const
+	{
+		return buffers[read];
+	}
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+// A uniform buffer holding one std140 block, BlockT, which must be laid out to match the GLSL declaration.
+// The buffer is only re-uploaded when a Set() actually changed the contents.
+template<typename BlockT>
+class UniformBuffer
+{
+	GLuint buffer;
+	BlockT block;
+	bool dirty = true;
+
+public:
+	UniformBuffer() : block()
+	{
+		static_assert(sizeof(BlockT) % 16 == 0, "std140 blocks are padded to a multiple of vec4");
+
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(BlockT), NULL, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	~UniformBuffer()
+	{
+		glDeleteBuffers(1, &buffer);
+	}
+
+	template<typename T>
+	void
+	Set(T BlockT::*member, const T &value)
+	{
+		if (block.*member != value)
+		{
+			block.*member = value;
+			dirty = true;
+		}
+	}
+
+	const BlockT &
+	Get() const
+	{
+		return block;
+	}
+
+	void
+	Bind(GLuint binding)
+	{
+		if (dirty)
+		{
+			glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(BlockT), &block);
+			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+			dirty = false;
+		}
+
+		glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+	}
+};